@@ -58,6 +58,7 @@ struct BuiltinFunctionsLib {
     virtual void initImageFunctions() = 0;
     virtual Kernel *getPageFaultFunction() = 0;
     virtual void initPageFaultFunction() = 0;
+    virtual void startWarmUp() = 0;
     MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
   protected:
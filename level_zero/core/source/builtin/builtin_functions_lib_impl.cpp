@@ -8,6 +8,7 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib_impl.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/os_interface/os_thread.h"
 
 namespace L0 {
 
@@ -20,131 +21,172 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
     return std::unique_lock<BuiltinFunctionsLib::MutexType>(this->ownershipMutex);
 }
 
+BuiltinFunctionsLibImpl::~BuiltinFunctionsLibImpl() {
+    if (warmUpThread) {
+        warmUpThread->join();
+    }
+}
+
 void BuiltinFunctionsLibImpl::initFunctions() {
     for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
-        const char *builtinName = nullptr;
-        NEO::EBuiltInOps::Type builtin;
-
-        switch (static_cast<Builtin>(builtId)) {
-        case Builtin::CopyBufferBytes:
-            builtinName = "copyBufferToBufferBytesSingle";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::CopyBufferRectBytes2d:
-            builtinName = "CopyBufferRectBytes2d";
-            builtin = NEO::EBuiltInOps::CopyBufferRect;
-            break;
-        case Builtin::CopyBufferRectBytes3d:
-            builtinName = "CopyBufferRectBytes3d";
-            builtin = NEO::EBuiltInOps::CopyBufferRect;
-            break;
-        case Builtin::CopyBufferToBufferMiddle:
-            builtinName = "CopyBufferToBufferMiddleRegion";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::CopyBufferToBufferSide:
-            builtinName = "CopyBufferToBufferSideRegion";
-            builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
-            break;
-        case Builtin::FillBufferImmediate:
-            builtinName = "FillBufferImmediate";
-            builtin = NEO::EBuiltInOps::FillBuffer;
-            break;
-        case Builtin::FillBufferSSHOffset:
-            builtinName = "FillBufferSSHOffset";
-            builtin = NEO::EBuiltInOps::FillBuffer;
-            break;
-        case Builtin::QueryKernelTimestamps:
-            builtinName = "QueryKernelTimestamps";
-            builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
-            break;
-        case Builtin::QueryKernelTimestampsWithOffsets:
-            builtinName = "QueryKernelTimestampsWithOffsets";
-            builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
-            break;
-        default:
-            continue;
-        };
-
-        builtins[builtId] = loadBuiltIn(builtin, builtinName);
+        getFunction(static_cast<Builtin>(builtId));
     }
 }
 
+void BuiltinFunctionsLibImpl::initBuiltinFunction(Builtin func) {
+    auto builtId = static_cast<uint32_t>(func);
+    const char *builtinName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+
+    switch (func) {
+    case Builtin::CopyBufferBytes:
+        builtinName = "copyBufferToBufferBytesSingle";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::CopyBufferRectBytes2d:
+        builtinName = "CopyBufferRectBytes2d";
+        builtin = NEO::EBuiltInOps::CopyBufferRect;
+        break;
+    case Builtin::CopyBufferRectBytes3d:
+        builtinName = "CopyBufferRectBytes3d";
+        builtin = NEO::EBuiltInOps::CopyBufferRect;
+        break;
+    case Builtin::CopyBufferToBufferMiddle:
+        builtinName = "CopyBufferToBufferMiddleRegion";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::CopyBufferToBufferSide:
+        builtinName = "CopyBufferToBufferSideRegion";
+        builtin = NEO::EBuiltInOps::CopyBufferToBuffer;
+        break;
+    case Builtin::FillBufferImmediate:
+        builtinName = "FillBufferImmediate";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
+    case Builtin::FillBufferSSHOffset:
+        builtinName = "FillBufferSSHOffset";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
+    case Builtin::QueryKernelTimestamps:
+        builtinName = "QueryKernelTimestamps";
+        builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
+        break;
+    case Builtin::QueryKernelTimestampsWithOffsets:
+        builtinName = "QueryKernelTimestampsWithOffsets";
+        builtin = NEO::EBuiltInOps::QueryKernelTimestamps;
+        break;
+    default:
+        return;
+    };
+
+    builtins[builtId] = loadBuiltIn(builtin, builtinName);
+}
+
 void BuiltinFunctionsLibImpl::initImageFunctions() {
     for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::COUNT); builtId++) {
-        const char *builtinName = nullptr;
-        NEO::EBuiltInOps::Type builtin;
-
-        switch (static_cast<ImageBuiltin>(builtId)) {
-        case ImageBuiltin::CopyBufferToImage3d16Bytes:
-            builtinName = "CopyBufferToImage3d16Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case ImageBuiltin::CopyBufferToImage3d2Bytes:
-            builtinName = "CopyBufferToImage3d2Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case ImageBuiltin::CopyBufferToImage3d4Bytes:
-            builtinName = "CopyBufferToImage3d4Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case ImageBuiltin::CopyBufferToImage3d8Bytes:
-            builtinName = "CopyBufferToImage3d8Bytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case ImageBuiltin::CopyBufferToImage3dBytes:
-            builtinName = "CopyBufferToImage3dBytes";
-            builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer16Bytes:
-            builtinName = "CopyImage3dToBuffer16Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer2Bytes:
-            builtinName = "CopyImage3dToBuffer2Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer4Bytes:
-            builtinName = "CopyImage3dToBuffer4Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBuffer8Bytes:
-            builtinName = "CopyImage3dToBuffer8Bytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImage3dToBufferBytes:
-            builtinName = "CopyImage3dToBufferBytes";
-            builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
-            break;
-        case ImageBuiltin::CopyImageRegion:
-            builtinName = "CopyImageToImage3d";
-            builtin = NEO::EBuiltInOps::CopyImageToImage3d;
-            break;
-        default:
-            continue;
-        };
-
-        imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
+        getImageFunction(static_cast<ImageBuiltin>(builtId));
     }
 }
 
+void BuiltinFunctionsLibImpl::initBuiltinImageFunction(ImageBuiltin func) {
+    auto builtId = static_cast<uint32_t>(func);
+    const char *builtinName = nullptr;
+    NEO::EBuiltInOps::Type builtin;
+
+    switch (func) {
+    case ImageBuiltin::CopyBufferToImage3d16Bytes:
+        builtinName = "CopyBufferToImage3d16Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case ImageBuiltin::CopyBufferToImage3d2Bytes:
+        builtinName = "CopyBufferToImage3d2Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case ImageBuiltin::CopyBufferToImage3d4Bytes:
+        builtinName = "CopyBufferToImage3d4Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case ImageBuiltin::CopyBufferToImage3d8Bytes:
+        builtinName = "CopyBufferToImage3d8Bytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case ImageBuiltin::CopyBufferToImage3dBytes:
+        builtinName = "CopyBufferToImage3dBytes";
+        builtin = NEO::EBuiltInOps::CopyBufferToImage3d;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer16Bytes:
+        builtinName = "CopyImage3dToBuffer16Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer2Bytes:
+        builtinName = "CopyImage3dToBuffer2Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer4Bytes:
+        builtinName = "CopyImage3dToBuffer4Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBuffer8Bytes:
+        builtinName = "CopyImage3dToBuffer8Bytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImage3dToBufferBytes:
+        builtinName = "CopyImage3dToBufferBytes";
+        builtin = NEO::EBuiltInOps::CopyImage3dToBuffer;
+        break;
+    case ImageBuiltin::CopyImageRegion:
+        builtinName = "CopyImageToImage3d";
+        builtin = NEO::EBuiltInOps::CopyImageToImage3d;
+        break;
+    default:
+        return;
+    };
+
+    imageBuiltins[builtId] = loadBuiltIn(builtin, builtinName);
+}
+
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
+    std::call_once(builtinsInitialized[builtId], [&]() { initBuiltinFunction(func); });
     return builtins[builtId]->func.get();
 }
 Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
+    std::call_once(imageBuiltinsInitialized[builtId], [&]() { initBuiltinImageFunction(func); });
     return imageBuiltins[builtId]->func.get();
 }
 
 void BuiltinFunctionsLibImpl::initPageFaultFunction() {
-    pageFaultBuiltin = loadBuiltIn(NEO::EBuiltInOps::CopyBufferToBuffer, "CopyBufferToBufferSideRegion");
+    getPageFaultFunction();
 }
 
 Kernel *BuiltinFunctionsLibImpl::getPageFaultFunction() {
+    std::call_once(pageFaultBuiltinInitialized, [&]() {
+        pageFaultBuiltin = loadBuiltIn(NEO::EBuiltInOps::CopyBufferToBuffer, "CopyBufferToBufferSideRegion");
+    });
     return pageFaultBuiltin->func.get();
 }
 
+void BuiltinFunctionsLibImpl::startWarmUp() {
+    if (!warmUpThread) {
+        warmUpThread = NEO::Thread::create(warmUp, reinterpret_cast<void *>(this));
+    }
+}
+
+void *BuiltinFunctionsLibImpl::warmUp(void *arg) {
+    auto self = reinterpret_cast<BuiltinFunctionsLibImpl *>(arg);
+    constexpr Builtin copyAndFillBuiltins[] = {Builtin::CopyBufferBytes,
+                                               Builtin::CopyBufferToBufferMiddle,
+                                               Builtin::CopyBufferToBufferSide,
+                                               Builtin::FillBufferImmediate,
+                                               Builtin::FillBufferSSHOffset};
+    for (auto builtin : copyAndFillBuiltins) {
+        self->getFunction(builtin);
+    }
+    self->getPageFaultFunction();
+    return nullptr;
+}
+
 std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
     using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
 
@@ -11,11 +11,14 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <mutex>
+
 namespace NEO {
 namespace EBuiltInOps {
 using Type = uint32_t;
 }
 class BuiltIns;
+class Thread;
 } // namespace NEO
 
 namespace L0 {
@@ -24,11 +27,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib)
         : device(device), builtInsLib(builtInsLib) {
     }
-    ~BuiltinFunctionsLibImpl() override {
-        builtins->reset();
-        pageFaultBuiltin.reset();
-        imageBuiltins->reset();
-    }
+    ~BuiltinFunctionsLibImpl() override;
 
     Kernel *getFunction(Builtin func) override;
     Kernel *getImageFunction(ImageBuiltin func) override;
@@ -36,12 +35,21 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     void initFunctions() override;
     void initImageFunctions() override;
     void initPageFaultFunction() override;
+    void startWarmUp() override;
     std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName);
 
   protected:
+    void initBuiltinFunction(Builtin func);
+    void initBuiltinImageFunction(ImageBuiltin func);
+    static void *warmUp(void *arg);
+
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::COUNT)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::COUNT)];
     std::unique_ptr<BuiltinData> pageFaultBuiltin;
+    std::once_flag builtinsInitialized[static_cast<uint32_t>(Builtin::COUNT)];
+    std::once_flag imageBuiltinsInitialized[static_cast<uint32_t>(ImageBuiltin::COUNT)];
+    std::once_flag pageFaultBuiltinInitialized;
+    std::unique_ptr<NEO::Thread> warmUpThread;
 
     Device *device;
     NEO::BuiltIns *builtInsLib;
@@ -578,10 +578,16 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
     }
 
     if (neoDevice->getCompilerInterface()) {
-        device->getBuiltinFunctionsLib()->initFunctions();
-        device->getBuiltinFunctionsLib()->initPageFaultFunction();
-        if (device->getHwInfo().capabilityTable.supportsImages) {
-            device->getBuiltinFunctionsLib()->initImageFunctions();
+        // builtins are loaded on first use unless requested otherwise
+        auto builtinsInitMode = NEO::DebugManager.flags.LevelZeroBuiltinsInitMode.get();
+        if (builtinsInitMode == 1) {
+            device->getBuiltinFunctionsLib()->initFunctions();
+            device->getBuiltinFunctionsLib()->initPageFaultFunction();
+            if (device->getHwInfo().capabilityTable.supportsImages) {
+                device->getBuiltinFunctionsLib()->initImageFunctions();
+            }
+        } else if (builtinsInitMode == 2) {
+            device->getBuiltinFunctionsLib()->startWarmUp();
         }
     }
 
@@ -21,8 +21,10 @@ struct _ze_kernel_handle_t {};
 
 namespace NEO {
 class Device;
+class IsaHeapAllocator;
 struct KernelInfo;
 class MemoryManager;
+struct MemoryTransfer;
 } // namespace NEO
 
 namespace L0 {
@@ -33,9 +35,11 @@ struct KernelImmutableData {
     KernelImmutableData(L0::Device *l0device = nullptr);
     virtual ~KernelImmutableData();
 
+    // when isaTransfers is given, ISA upload is appended to it instead of being performed immediately
     void initialize(NEO::KernelInfo *kernelInfo, Device *device,
                     uint32_t computeUnitsUsedForSratch,
-                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel);
+                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                    std::vector<NEO::MemoryTransfer> *isaTransfers = nullptr);
 
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
@@ -47,6 +51,7 @@ struct KernelImmutableData {
 
     uint32_t getIsaSize() const;
     NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    size_t getIsaOffsetInParentAllocation() const { return isaOffsetInParentAllocation; }
 
     uint64_t getPrivateMemorySize() const;
     NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() const { return privateMemoryGraphicsAllocation.get(); }
@@ -67,6 +72,9 @@ struct KernelImmutableData {
     Device *device = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::IsaHeapAllocator *isaHeapAllocator = nullptr; // set when isaGraphicsAllocation is an arena shared with other kernels
+    size_t isaOffsetInParentAllocation = 0U;
+    uint32_t isaSizeInParentAllocation = 0U;
     std::unique_ptr<NEO::GraphicsAllocation> privateMemoryGraphicsAllocation = nullptr;
 
     uint32_t crossThreadDataSize = 0;
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/arrayref.h"
 
@@ -67,7 +68,9 @@ inline SamplerPatchValues getAddrMode(ze_sampler_address_mode_t addressingMode)
 KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device) {}
 
 KernelImmutableData::~KernelImmutableData() {
-    if (nullptr != isaGraphicsAllocation) {
+    if (nullptr != isaHeapAllocator) {
+        isaHeapAllocator->free(isaGraphicsAllocation.release(), isaOffsetInParentAllocation);
+    } else if (nullptr != isaGraphicsAllocation) {
         this->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(&*isaGraphicsAllocation);
         isaGraphicsAllocation.release();
     }
@@ -99,7 +102,8 @@ inline void patchWithImplicitSurface(ArrayRef<uint8_t> crossThreadData, ArrayRef
 void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device,
                                      uint32_t computeUnitsUsedForSratch,
                                      NEO::GraphicsAllocation *globalConstBuffer,
-                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel) {
+                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                                     std::vector<NEO::MemoryTransfer> *isaTransfers) {
 
     UNRECOVERABLE_IF(kernelInfo == nullptr);
     this->kernelDescriptor = &kernelInfo->kernelDescriptor;
@@ -110,17 +114,35 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
     auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
     const auto allocType = internalKernel ? NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : NEO::GraphicsAllocation::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+    NEO::GraphicsAllocation *allocation = nullptr;
+    if (!internalKernel && neoDevice->getIsaHeapAllocator()) {
+        allocation = neoDevice->getIsaHeapAllocator()->allocate(kernelIsaSize, isaOffsetInParentAllocation);
+        if (allocation) {
+            isaHeapAllocator = neoDevice->getIsaHeapAllocator();
+            isaSizeInParentAllocation = kernelIsaSize;
+        }
+    }
+    if (!allocation) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+    }
     UNRECOVERABLE_IF(allocation == nullptr);
 
     auto &hwInfo = neoDevice->getHardwareInfo();
     auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
     if (kernelInfo->heapInfo.pKernelHeap != nullptr) {
-        NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
-                                                              *neoDevice, allocation, 0, kernelInfo->heapInfo.pKernelHeap,
-                                                              static_cast<size_t>(kernelIsaSize));
+        NEO::MemoryTransfer isaTransfer;
+        isaTransfer.dstAllocation = allocation;
+        isaTransfer.dstOffset = isaOffsetInParentAllocation;
+        isaTransfer.srcMemory = kernelInfo->heapInfo.pKernelHeap;
+        isaTransfer.srcSize = static_cast<size_t>(kernelIsaSize);
+        isaTransfer.useBlitter = hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation);
+        if (isaTransfers != nullptr) {
+            isaTransfers->push_back(isaTransfer);
+        } else {
+            NEO::MemoryTransferHelper::transferMemoryToAllocations(*neoDevice, {isaTransfer});
+        }
     }
 
     isaGraphicsAllocation.reset(allocation);
@@ -204,6 +226,9 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (isaHeapAllocator) {
+        return isaSizeInParentAllocation;
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -773,4 +798,8 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return static_cast<uint64_t>(getImmutableData()->getIsaOffsetInParentAllocation());
+}
+
 } // namespace L0
@@ -7,14 +7,18 @@
 
 #include "level_zero/core/source/module/module_imp.h"
 
+#include "shared/source/compiler_interface/compiler_build_pool.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/program_info_cache.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
@@ -28,6 +32,7 @@
 #include "program_debug_data.h"
 
 #include <memory>
+#include <unordered_map>
 
 namespace L0 {
 
@@ -110,7 +115,14 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
     inputArgs.specializedValues = this->specConstantsValues;
     NEO::TranslationOutput compilerOuput = {};
-    auto compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
+    auto compilerErr = NEO::TranslationOutput::ErrorCode::UnknownError;
+    if (NEO::DebugManager.flags.EnableCompilerBuildPool.get() == 1) {
+        // identical modules created concurrently are compiled once
+        auto buildPool = device->getNEODevice()->getExecutionEnvironment()->getCompilerBuildPool();
+        compilerErr = buildPool->build(*compilerInterface, *device->getNEODevice(), inputArgs, compilerOuput);
+    } else {
+        compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
+    }
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
     this->updateBuildLog(compilerOuput.backendCompilerLog);
     if (NEO::TranslationOutput::ErrorCode::Success != compilerErr) {
@@ -185,7 +197,7 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
 
     NEO::DecodeError decodeError;
     NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinaryWithCache(programInfo, binary, *device->getNEODevice(), decodeErrors, decodeWarnings);
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
     }
@@ -213,12 +225,17 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
     }
 
     auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    NEO::MemoryTransfers globalsTransfers;
     if (programInfo.globalConstants.size != 0) {
-        this->globalConstBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalConstants.size, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData);
+        this->globalConstBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalConstants.size, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData, globalsTransfers);
     }
 
     if (programInfo.globalVariables.size != 0) {
-        this->globalVarBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalVariables.size, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData);
+        this->globalVarBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), programInfo.globalVariables.size, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData, globalsTransfers);
+    }
+
+    if (!NEO::MemoryTransferHelper::transferMemoryToAllocations(*device->getNEODevice(), globalsTransfers)) {
+        return false;
     }
 
     for (auto &kernelInfo : this->programInfo.kernelInfos) {
@@ -349,13 +366,18 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     }
 
     kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
+    NEO::MemoryTransfers isaTransfers;
+    isaTransfers.reserve(this->translationUnit->programInfo.kernelInfos.size());
     for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
         kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
                                   this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
-                                  this->type == ModuleType::Builtin);
+                                  this->type == ModuleType::Builtin, &isaTransfers);
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
+    if (!NEO::MemoryTransferHelper::transferMemoryToAllocations(*device->getNEODevice(), isaTransfers)) {
+        return false;
+    }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
 
     return this->linkBinary();
@@ -431,15 +453,24 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        auto &hwInfo = this->device->getHwInfo();
+        auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+        NEO::MemoryTransfers isaTransfers;
+        isaTransfers.reserve(this->kernelImmDatas.size());
         for (const auto &kernelImmData : this->kernelImmDatas) {
             if (nullptr == kernelImmData->getIsaGraphicsAllocation()) {
                 continue;
             }
             auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
-            this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(), 0,
-                                                                                        isaSegmentsForPatching[segmentId].hostPointer,
-                                                                                        isaSegmentsForPatching[segmentId].segmentSize);
+            NEO::MemoryTransfer isaTransfer;
+            isaTransfer.dstAllocation = kernelImmData->getIsaGraphicsAllocation();
+            isaTransfer.dstOffset = kernelImmData->getIsaOffsetInParentAllocation();
+            isaTransfer.srcMemory = isaSegmentsForPatching[segmentId].hostPointer;
+            isaTransfer.srcSize = isaSegmentsForPatching[segmentId].segmentSize;
+            isaTransfer.useBlitter = hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *isaTransfer.dstAllocation);
+            isaTransfers.push_back(isaTransfer);
         }
+        NEO::MemoryTransferHelper::transferMemoryToAllocations(*this->device->getNEODevice(), isaTransfers);
     }
 }
 
@@ -465,9 +496,10 @@ bool ModuleImp::linkBinary() {
     }
     if (this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsImmData->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsImmData->getIsaSize();
     }
     Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
@@ -603,15 +635,46 @@ ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties)
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    struct ExportedSymbol {
+        const NEO::Linker::RelocatedSymbol *symbol = nullptr;
+        ModuleImp *module = nullptr;
+    };
+    std::unordered_map<NEO::SymbolId, ExportedSymbol> exportedSymbols;
+    bool exportedSymbolsCollected = false;
+
+    // symbol ids of each module's LinkerInput translated into ids of this link set
+    NEO::SymbolNameTable linkSetSymbolNames;
+    std::vector<std::vector<NEO::SymbolId>> linkSetSymbolIds(numModules);
+    auto getLinkSetSymbolId = [&](uint32_t moduleIndex, NEO::SymbolId moduleSymbolId, const std::string &symbolName) {
+        const auto &moduleSymbolIds = linkSetSymbolIds[moduleIndex];
+        return (moduleSymbolId < moduleSymbolIds.size()) ? moduleSymbolIds[moduleSymbolId] : linkSetSymbolNames.intern(symbolName);
+    };
 
     for (auto i = 0u; i < numModules; i++) {
         auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
         if (moduleId->isFullyLinked) {
             continue;
         }
+        if (false == exportedSymbolsCollected) {
+            // first module exporting given symbol wins
+            for (auto j = 0u; j < numModules; j++) {
+                auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[j]));
+                if (moduleHandle->translationUnit->programInfo.linkerInput) {
+                    const auto &moduleSymbolNames = moduleHandle->translationUnit->programInfo.linkerInput->getSymbolNames();
+                    linkSetSymbolIds[j].reserve(moduleSymbolNames.size());
+                    for (NEO::SymbolId symbolId = 0; symbolId < moduleSymbolNames.size(); symbolId++) {
+                        linkSetSymbolIds[j].push_back(linkSetSymbolNames.intern(moduleSymbolNames.getName(symbolId)));
+                    }
+                }
+                for (const auto &symbol : moduleHandle->symbols) {
+                    exportedSymbols.emplace(getLinkSetSymbolId(j, symbol.second.symbol.symbolId, symbol.first), ExportedSymbol{&symbol.second, moduleHandle});
+                }
+            }
+            exportedSymbolsCollected = true;
+        }
         NEO::Linker::PatchableSegments isaSegmentsForPatching;
+        NEO::Linker::PatchPlan patchPlan;
         std::vector<std::vector<char>> patchedIsaTempStorage;
-        uint32_t numPatchedSymbols = 0u;
         if (moduleId->translationUnit->programInfo.linkerInput && moduleId->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
             patchedIsaTempStorage.reserve(moduleId->kernelImmDatas.size());
             for (const auto &kernelInfo : moduleId->translationUnit->programInfo.kernelInfos) {
@@ -620,26 +683,20 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                 patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
                 isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), kernHeapInfo.KernelHeapSize});
             }
+            patchPlan.reserve(moduleId->unresolvedExternalsInfo.size());
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
-                for (auto i = 0u; i < numModules; i++) {
-                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
-
-                    auto symbolIt = moduleHandle->symbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
-                    if (symbolIt != moduleHandle->symbols.end()) {
-                        auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
-                                                      static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
-
-                        NEO::Linker::patchAddress(relocAddress, symbolIt->second, unresolvedExternal.unresolvedRelocation);
-                        numPatchedSymbols++;
-                        moduleId->importedSymbolAllocations.insert(moduleHandle->exportedFunctionsSurface);
-                        break;
-                    }
+                const auto &relocation = unresolvedExternal.unresolvedRelocation;
+                auto symbolIt = exportedSymbols.find(getLinkSetSymbolId(i, relocation.symbolId, relocation.symbolName));
+                if (symbolIt != exportedSymbols.end()) {
+                    patchPlan.push_back(NEO::Linker::PatchPlanEntry{relocation.offset, symbolIt->second.symbol->gpuAddress, relocation.type, unresolvedExternal.instructionsSegmentId});
+                    moduleId->importedSymbolAllocations.insert(symbolIt->second.module->exportedFunctionsSurface);
                 }
             }
         }
-        if (numPatchedSymbols != moduleId->unresolvedExternalsInfo.size()) {
+        if (patchPlan.size() != moduleId->unresolvedExternalsInfo.size()) {
             return ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
         }
+        NEO::Linker::applyPatchPlan(patchPlan, isaSegmentsForPatching);
         moduleId->copyPatchedSegments(isaSegmentsForPatching);
         moduleId->isFullyLinked = true;
     }
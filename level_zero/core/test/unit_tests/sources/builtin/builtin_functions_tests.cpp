@@ -29,6 +29,8 @@ class TestBuiltinFunctionsLibImpl : public DeviceFixture, public testing::Test {
         using BuiltinFunctionsLibImpl::builtins;
         using BuiltinFunctionsLibImpl::getFunction;
         using BuiltinFunctionsLibImpl::imageBuiltins;
+        using BuiltinFunctionsLibImpl::pageFaultBuiltin;
+        using BuiltinFunctionsLibImpl::warmUpThread;
         MockBuiltinFunctionsLibImpl(L0::Device *device, NEO::BuiltIns *builtInsLib) : BuiltinFunctionsLibImpl(device, builtInsLib) {}
     };
 
@@ -87,6 +89,63 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceThen
     }
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinNotLoadedWhenGettingFunctionThenOnlyThisBuiltinIsLoadedOnce) {
+    auto kernel = mockBuiltinFunctionsLibImpl->getFunction(Builtin::FillBufferImmediate);
+    EXPECT_NE(nullptr, kernel);
+    EXPECT_EQ(kernel, mockBuiltinFunctionsLibImpl->getFunction(Builtin::FillBufferImmediate));
+
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        if (builtId != static_cast<uint32_t>(Builtin::FillBufferImmediate)) {
+            EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl->builtins[builtId]);
+        }
+    }
+    EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl->pageFaultBuiltin);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenWarmUpStartedWhenWarmUpThreadFinishesThenCopyAndFillBuiltinsAreLoaded) {
+    mockBuiltinFunctionsLibImpl->startWarmUp();
+    ASSERT_NE(nullptr, mockBuiltinFunctionsLibImpl->warmUpThread);
+    mockBuiltinFunctionsLibImpl->warmUpThread->join();
+    mockBuiltinFunctionsLibImpl->warmUpThread.reset();
+
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::CopyBufferBytes)]);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::CopyBufferToBufferMiddle)]);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::CopyBufferToBufferSide)]);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::FillBufferImmediate)]);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::FillBufferSSHOffset)]);
+    EXPECT_NE(nullptr, mockBuiltinFunctionsLibImpl->pageFaultBuiltin);
+    EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl->builtins[static_cast<uint32_t>(Builtin::QueryKernelTimestamps)]);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenWarmUpStartedWhenLibIsDestroyedThenWarmUpThreadIsJoined) {
+    mockBuiltinFunctionsLibImpl->startWarmUp();
+    mockBuiltinFunctionsLibImpl.reset();
+    EXPECT_EQ(nullptr, mockBuiltinFunctionsLibImpl);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenEagerBuiltinsInitModeWhenCreateDeviceThenAllBuiltinsAreLoadedAtCreation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.LevelZeroBuiltinsInitMode.set(1);
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterface());
+    std::unique_ptr<L0::Device> testDevice(Device::create(device->getDriverHandle(), neoDevice, std::numeric_limits<uint32_t>::max(), false));
+
+    auto builtinsLib = static_cast<MockBuiltinFunctionsLibImpl *>(testDevice->getBuiltinFunctionsLib());
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_NE(nullptr, builtinsLib->builtins[builtId]);
+    }
+    EXPECT_NE(nullptr, builtinsLib->pageFaultBuiltin);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenDefaultBuiltinsInitModeWhenCreateDeviceThenBuiltinsAreNotLoadedAtCreation) {
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterface());
+    std::unique_ptr<L0::Device> testDevice(Device::create(device->getDriverHandle(), neoDevice, std::numeric_limits<uint32_t>::max(), false));
+
+    auto builtinsLib = static_cast<MockBuiltinFunctionsLibImpl *>(testDevice->getBuiltinFunctionsLib());
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::COUNT); builtId++) {
+        EXPECT_EQ(nullptr, builtinsLib->builtins[builtId]);
+    }
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenRebuildPrecompiledKernelsDebugFlagWhenInitFuctionsThenIntermediateCodeForBuiltinsIsRequested) {
     struct MockDeviceForRebuildBuilins : public Mock<DeviceImp> {
         struct MockModuleForRebuildBuiltins : public ModuleImp {
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/compiler_interface/compiler_build_pool.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
@@ -764,6 +766,34 @@ HWTEST_F(ModuleTranslationUnitTest, WhenBuildOptionsAreNullThenReuseExistingOpti
     EXPECT_NE(mockCompilerInterface.inputInternalOptions.find("cl-intel-greater-than-4GB-buffer-required"), std::string::npos);
 }
 
+HWTEST_F(ModuleTranslationUnitTest, givenEnableCompilerBuildPoolWhenBuildingFromSpirVThenInputIsCompiledByExecutionEnvironmentsBuildPool) {
+    struct MockCompilerInterface : CompilerInterface {
+        TranslationOutput::ErrorCode build(const NEO::Device &device,
+                                           const TranslationInput &input,
+                                           TranslationOutput &output) override {
+            receivedSrc = input.src.begin();
+            receivedSrcContents.assign(input.src.begin(), input.src.end());
+            return TranslationOutput::ErrorCode::Success;
+        }
+        const char *receivedSrc = nullptr;
+        std::string receivedSrcContents;
+    } mockCompilerInterface;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCompilerBuildPool.set(1);
+
+    const char spirv[] = "spirv";
+    MockModuleTranslationUnit moduleTu(this->device);
+    this->neoDevice->mockCompilerInterface = &mockCompilerInterface;
+    auto ret = moduleTu.buildFromSpirV(spirv, sizeof(spirv), nullptr, "", nullptr);
+    EXPECT_TRUE(ret);
+
+    // build pool compiles own copy of the input
+    EXPECT_NE(spirv, mockCompilerInterface.receivedSrc);
+    EXPECT_EQ(std::string(spirv, sizeof(spirv)), mockCompilerInterface.receivedSrcContents);
+    EXPECT_EQ(0U, neoDevice->getExecutionEnvironment()->getCompilerBuildPool()->getThreadsCount());
+}
+
 TEST(BuildOptions, givenNoSrcOptionNameInSrcNamesWhenMovingBuildOptionsThenFalseIsReturned) {
     std::string srcNames = NEO::CompilerOptions::concatenate(NEO::CompilerOptions::fastRelaxedMath, NEO::CompilerOptions::finiteMathOnly);
     std::string dstNames;
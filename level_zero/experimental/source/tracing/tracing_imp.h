@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
@@ -27,6 +29,7 @@
 
 #include "ze_ddi_tables.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <list>
@@ -142,12 +145,19 @@ class APITracerCallbackStateImp {
     void *pUserData;
 };
 
+// Per-call callback state lives on the stack of the traced API call, heap is used only
+// when more tracers than this are enabled at the same time
+constexpr size_t tracerCallbacksOnStackCapacity = 8;
+
+template <class T>
+using APITracerCallbackStateList = StackVec<APITracerCallbackStateImp<T>, tracerCallbacksOnStackCapacity>;
+
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = {};
-    std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
+    APITracerCallbackStateList<T> prologCallbacks;
+    APITracerCallbackStateList<T> epilogCallbacks;
 };
 
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
@@ -189,24 +199,22 @@ template <typename TFunction_pointer, typename TParams, typename TTracer, typena
 ze_result_t APITracerWrapperImp(TFunction_pointer zeApiPtr,
                                 TParams paramsStruct,
                                 TTracer apiOrdinal,
-                                TTracerPrologCallbacks prologCallbacks,
-                                TTracerEpilogCallbacks epilogCallbacks,
+                                TTracerPrologCallbacks &prologCallbacks,
+                                TTracerEpilogCallbacks &epilogCallbacks,
                                 Args &&... args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs = &prologCallbacks;
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    StackVec<void *, tracerCallbacksOnStackCapacity> ppTracerInstanceUserData;
+    ppTracerInstanceUserData.resize(std::max(prologCallbacks.size(), epilogCallbacks.size()), nullptr);
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(paramsStruct, ret, callbacks_prologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < prologCallbacks.size(); i++) {
+        if (prologCallbacks[i].current_api_callback != nullptr)
+            prologCallbacks[i].current_api_callback(paramsStruct, ret, prologCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(paramsStruct, ret, callbacksEpilogs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < epilogCallbacks.size(); i++) {
+        if (epilogCallbacks[i].current_api_callback != nullptr)
+            epilogCallbacks[i].current_api_callback(paramsStruct, ret, epilogCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     L0::tracingInProgress = 0;
     L0::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -302,6 +302,32 @@ TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithMoreTracersThanOnStackCapacityThenEachTracerGetsItsOwnInstanceData) {
+    MockCommandList commandList;
+    ze_result_t result;
+    int user_data = 5;
+    ze_command_list_close_params_t tracerParams;
+
+    ze_command_list_handle_t command_list_handle = commandList.toHandle();
+    tracerParams.phCommandList = &command_list_handle;
+
+    APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> apiCallbackData;
+    for (size_t i = 0; i < tracerCallbacksOnStackCapacity + 1; i++) {
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
+        prologCallback.current_api_callback = OnEnterCommandListCloseWithUserDataAndAllocateInstanceData;
+        epilogCallback.current_api_callback = OnExitCommandListCloseWithUserDataAndReadInstanceData;
+        prologCallback.pUserData = &user_data;
+        epilogCallback.pUserData = &user_data;
+        apiCallbackData.prologCallbacks.push_back(prologCallback);
+        apiCallbackData.epilogCallbacks.push_back(epilogCallback);
+    }
+    EXPECT_TRUE(apiCallbackData.prologCallbacks.usesDynamicMem());
+
+    result = APITracerWrapperImp(zeCommandListClose, &tracerParams, apiCallbackData.apiOrdinal, apiCallbackData.prologCallbacks, apiCallbackData.epilogCallbacks, *tracerParams.phCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
 TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsWithRecursionHandledAndSuccessIsReturned) {
     MockCommandList commandList;
     ze_result_t result;
@@ -521,15 +521,20 @@ bool MetricGroupImp::getCalculatedMetricValues(const zet_metric_group_calculatio
         return false;
     }
 
-    // Calculated metrics / maximum values container.
-    std::vector<MetricsDiscovery::TTypedValue_1_0> calculatedMetrics(expectedMetricValueCount);
-    std::vector<MetricsDiscovery::TTypedValue_1_0> maximumValues(expectedMetricValueCount);
+    std::lock_guard<std::mutex> lock(calculationMutex);
+
+    // Calculated metrics / maximum values containers are kept between calls
+    // and only grow, so repeated calculations do not allocate.
+    if (calculatedMetrics.size() < expectedMetricValueCount) {
+        calculatedMetrics.resize(expectedMetricValueCount);
+        maximumValues.resize(expectedMetricValueCount);
+    }
 
     // Set filtering type.
     pReferenceMetricSet->SetApiFiltering(MetricGroupImp::getApiMask(properties.samplingType));
 
     // Calculate metrics.
-    const uint32_t outMetricsSize = static_cast<uint32_t>(calculatedMetrics.size()) * sizeof(MetricsDiscovery::TTypedValue_1_0);
+    const uint32_t outMetricsSize = expectedMetricValueCount * sizeof(MetricsDiscovery::TTypedValue_1_0);
     bool result = pReferenceMetricSet->CalculateMetrics(
                       reinterpret_cast<unsigned char *>(const_cast<uint8_t *>(pRawData)), static_cast<uint32_t>(rawDataSize),
                       calculatedMetrics.data(),
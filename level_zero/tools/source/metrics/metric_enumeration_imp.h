@@ -13,6 +13,7 @@
 
 #include "metrics_discovery_api.h"
 
+#include <mutex>
 #include <vector>
 
 namespace L0 {
@@ -116,6 +117,11 @@ struct MetricGroupImp : MetricGroup {
     };
     MetricsDiscovery::IMetricSet_1_5 *pReferenceMetricSet = nullptr;
     MetricsDiscovery::IConcurrentGroup_1_5 *pReferenceConcurrentGroup = nullptr;
+
+    // Reusable calculation outputs.
+    std::mutex calculationMutex;
+    std::vector<MetricsDiscovery::TTypedValue_1_0> calculatedMetrics;
+    std::vector<MetricsDiscovery::TTypedValue_1_0> maximumValues;
 };
 
 struct MetricImp : Metric {
@@ -7,13 +7,25 @@
 
 #include "level_zero/tools/source/metrics/metric_streamer_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/tools/source/metrics/metric_query_imp.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 namespace L0 {
 
+// Upper bound of a single host buffer half used in background drain mode.
+constexpr size_t maxHostBufferSize = 16 * 1024 * 1024;
+
+MetricStreamerImp::~MetricStreamerImp() {
+    stopBackgroundDrain();
+}
+
 ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
                                         uint8_t *pRawData) {
     DEBUG_BREAK_IF(rawReportSize == 0);
@@ -31,6 +43,11 @@ ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDat
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    // Reports were already moved to host memory by the drain thread.
+    if (backgroundDrainEnabled) {
+        return readDrainedData(pRawDataSize, pRawData);
+    }
+
     // Retrieve the number of reports that fit into the buffer.
     uint32_t reportCount = static_cast<uint32_t>(*pRawDataSize / rawReportSize);
 
@@ -44,6 +61,8 @@ ze_result_t MetricStreamerImp::readData(uint32_t maxReportCount, size_t *pRawDat
 }
 
 ze_result_t MetricStreamerImp::close() {
+    stopBackgroundDrain();
+
     const auto result = stopMeasurements();
     if (result == ZE_RESULT_SUCCESS) {
 
@@ -102,9 +121,213 @@ ze_result_t MetricStreamerImp::startMeasurements(uint32_t &notifyEveryNReports,
         pNotificationEvent->metricStreamer = this;
     }
 
+    if (result == ZE_RESULT_SUCCESS && NEO::DebugManager.flags.EnableMetricStreamerBackgroundDrain.get()) {
+        startBackgroundDrain(notifyEveryNReports, samplingPeriodNs, true);
+    }
+
     return result;
 }
 
+void MetricStreamerImp::startBackgroundDrain(const uint32_t notifyEveryNReports, const uint32_t samplingPeriodNs, const bool startThread) {
+    DEBUG_BREAK_IF(rawReportSize == 0);
+
+    // Host buffer keeps about one second of reports, but never less than the oa buffer.
+    const uint64_t reportsPerSecond = samplingPeriodNs ? 1000000000ull / samplingPeriodNs : 0;
+    const size_t sizeForSecond = static_cast<size_t>(std::min<uint64_t>(reportsPerSecond * rawReportSize, maxHostBufferSize));
+    hostBufferCapacity = std::max<size_t>(oaBufferSize, sizeForSecond);
+    hostBufferCapacity -= hostBufferCapacity % rawReportSize;
+    hostBufferCapacity = std::max<size_t>(hostBufferCapacity, rawReportSize);
+
+    for (auto &hostBuffer : hostBuffers) {
+        hostBuffer.clear();
+        hostBuffer.reserve(hostBufferCapacity);
+    }
+    fillIndex = 0;
+    consumeOffset = 0;
+    droppedReportCount = 0;
+    reportedDroppedReportCount = 0;
+    drainScratch.resize(std::max(oaBufferSize, rawReportSize));
+
+    // Drain twice per notification period, so the oa buffer never gets more than half full.
+    const uint64_t notificationPeriodMs = static_cast<uint64_t>(notifyEveryNReports) * samplingPeriodNs / 1000000u;
+    drainTimeoutMs = static_cast<uint32_t>(std::max<uint64_t>(notificationPeriodMs / 2, 1u));
+
+    windowAggregates.assign(MetricGroup::getProperties(hMetricGroup).metricCount, MetricStreamerAggregate{});
+
+    backgroundDrainEnabled = true;
+    stopDrain = false;
+    if (startThread) {
+        drainThread = std::thread(&MetricStreamerImp::drainLoop, this);
+    }
+}
+
+void MetricStreamerImp::stopBackgroundDrain() {
+    if (drainThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(drainMutex);
+            stopDrain = true;
+        }
+        drainCondition.notify_one();
+        drainThread.join();
+    }
+}
+
+void MetricStreamerImp::drainLoop() {
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+
+    std::unique_lock<std::mutex> lock(drainMutex);
+    while (!stopDrain) {
+        lock.unlock();
+        const bool reportsReady = metricGroup->waitForReports(drainTimeoutMs) == ZE_RESULT_SUCCESS;
+        const bool reportsDrained = reportsReady && drainReports();
+        lock.lock();
+
+        if (!reportsDrained) {
+            drainCondition.wait_for(lock, std::chrono::milliseconds(drainTimeoutMs));
+        }
+    }
+}
+
+bool MetricStreamerImp::drainReports() {
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+
+    uint32_t reportCount = static_cast<uint32_t>(drainScratch.size() / rawReportSize);
+    if (metricGroup->readIoStream(reportCount, *drainScratch.data()) != ZE_RESULT_SUCCESS || reportCount == 0) {
+        return false;
+    }
+
+    const size_t drainedSize = static_cast<size_t>(reportCount) * rawReportSize;
+    aggregateReports(drainScratch.data(), drainedSize);
+
+    std::lock_guard<std::mutex> lock(drainMutex);
+    size_t storedSize = 0;
+    while (storedSize < drainedSize) {
+        auto &fillBuffer = hostBuffers[fillIndex];
+        if (fillBuffer.size() == hostBufferCapacity && !swapHostBuffers()) {
+            break;
+        }
+        const size_t chunkSize = std::min(drainedSize - storedSize, hostBufferCapacity - hostBuffers[fillIndex].size());
+        hostBuffers[fillIndex].insert(hostBuffers[fillIndex].end(), drainScratch.begin() + storedSize, drainScratch.begin() + storedSize + chunkSize);
+        storedSize += chunkSize;
+    }
+
+    // Both halves are full and application still reads the older one, newest reports are lost.
+    droppedReportCount += (drainedSize - storedSize) / rawReportSize;
+    return true;
+}
+
+bool MetricStreamerImp::swapHostBuffers() {
+    auto &consumeBuffer = hostBuffers[1 - fillIndex];
+    if (consumeOffset < consumeBuffer.size()) {
+        return false;
+    }
+
+    // Released half becomes the fill half.
+    consumeBuffer.clear();
+    consumeOffset = 0;
+    fillIndex = 1 - fillIndex;
+    return true;
+}
+
+uint64_t MetricStreamerImp::getDroppedReportCount() {
+    std::lock_guard<std::mutex> lock(drainMutex);
+    return droppedReportCount;
+}
+
+void MetricStreamerImp::aggregateReports(const uint8_t *pRawData, const size_t rawDataSize) {
+    const size_t metricCount = windowAggregates.size();
+    if (metricCount == 0) {
+        return;
+    }
+
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+    uint32_t valueCount = 0;
+    if (metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataSize, pRawData, &valueCount, nullptr) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+    if (calculatedValues.size() < valueCount) {
+        calculatedValues.resize(valueCount);
+    }
+    if (valueCount == 0 ||
+        metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataSize, pRawData, &valueCount, calculatedValues.data()) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(drainMutex);
+    for (uint32_t i = 0; i < valueCount; ++i) {
+        const auto &typedValue = calculatedValues[i];
+        double value = 0.0;
+        switch (typedValue.type) {
+        case ZET_VALUE_TYPE_UINT32:
+            value = static_cast<double>(typedValue.value.ui32);
+            break;
+        case ZET_VALUE_TYPE_UINT64:
+            value = static_cast<double>(typedValue.value.ui64);
+            break;
+        case ZET_VALUE_TYPE_FLOAT32:
+            value = static_cast<double>(typedValue.value.fp32);
+            break;
+        case ZET_VALUE_TYPE_FLOAT64:
+            value = typedValue.value.fp64;
+            break;
+        case ZET_VALUE_TYPE_BOOL8:
+            value = typedValue.value.b8 ? 1.0 : 0.0;
+            break;
+        default:
+            break;
+        }
+
+        auto &aggregate = windowAggregates[i % metricCount];
+        aggregate.minimum = aggregate.sampleCount ? std::min(aggregate.minimum, value) : value;
+        aggregate.maximum = aggregate.sampleCount ? std::max(aggregate.maximum, value) : value;
+        aggregate.sampleCount++;
+        aggregate.average += (value - aggregate.average) / static_cast<double>(aggregate.sampleCount);
+    }
+}
+
+void MetricStreamerImp::getAggregates(std::vector<MetricStreamerAggregate> &aggregates) {
+    std::lock_guard<std::mutex> lock(drainMutex);
+    aggregates = windowAggregates;
+    std::fill(windowAggregates.begin(), windowAggregates.end(), MetricStreamerAggregate{});
+}
+
+ze_result_t MetricStreamerImp::readDrainedData(size_t *pRawDataSize, uint8_t *pRawData) {
+    const size_t requestedSize = *pRawDataSize - (*pRawDataSize % rawReportSize);
+    size_t copiedSize = 0;
+
+    std::lock_guard<std::mutex> lock(drainMutex);
+    while (copiedSize < requestedSize) {
+        auto &consumeBuffer = hostBuffers[1 - fillIndex];
+        if (consumeOffset == consumeBuffer.size()) {
+            if (hostBuffers[fillIndex].empty()) {
+                break;
+            }
+            swapHostBuffers();
+            continue;
+        }
+
+        const size_t chunkSize = std::min(requestedSize - copiedSize, consumeBuffer.size() - consumeOffset);
+        memcpy(pRawData + copiedSize, consumeBuffer.data() + consumeOffset, chunkSize);
+        copiedSize += chunkSize;
+        consumeOffset += chunkSize;
+    }
+
+    // Hand fully read half back to the drain thread right away.
+    if (consumeOffset == hostBuffers[1 - fillIndex].size() && !hostBuffers[fillIndex].empty()) {
+        swapHostBuffers();
+    }
+
+    if (droppedReportCount > reportedDroppedReportCount) {
+        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                           "Metric streamer dropped %llu reports, zetMetricStreamerReadData is not called often enough\n",
+                           static_cast<unsigned long long>(droppedReportCount - reportedDroppedReportCount));
+        reportedDroppedReportCount = droppedReportCount;
+    }
+
+    *pRawDataSize = copiedSize;
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t MetricStreamerImp::stopMeasurements() {
     auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
 
@@ -130,6 +353,14 @@ uint32_t MetricStreamerImp::getNotifyEveryNReports(const uint32_t oaBufferSize)
 
 Event::State MetricStreamerImp::getNotificationState() {
 
+    if (backgroundDrainEnabled) {
+        std::lock_guard<std::mutex> lock(drainMutex);
+        const bool reportsDrained = consumeOffset < hostBuffers[1 - fillIndex].size() || !hostBuffers[fillIndex].empty();
+        return reportsDrained
+                   ? Event::State::STATE_SIGNALED
+                   : Event::State::STATE_INITIAL;
+    }
+
     auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
     bool reportsReady = metricGroup->waitForReports(0) == ZE_RESULT_SUCCESS;
 
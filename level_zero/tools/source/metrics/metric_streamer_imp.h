@@ -9,12 +9,25 @@
 
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 struct Event;
 
 namespace L0 {
 
+// Statistics of a single metric over reports drained within one aggregation window.
+struct MetricStreamerAggregate {
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double average = 0.0;
+    uint64_t sampleCount = 0;
+};
+
 struct MetricStreamerImp : MetricStreamer {
-    ~MetricStreamerImp() override{};
+    ~MetricStreamerImp() override;
 
     ze_result_t readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) override;
     ze_result_t close() override;
@@ -23,17 +36,51 @@ struct MetricStreamerImp : MetricStreamer {
     ze_result_t startMeasurements(uint32_t &notifyEveryNReports, uint32_t &samplingPeriodNs, ze_event_handle_t hNotificationEvent);
     Event::State getNotificationState() override;
 
+    // Background drain mode (EnableMetricStreamerBackgroundDrain).
+    void startBackgroundDrain(const uint32_t notifyEveryNReports, const uint32_t samplingPeriodNs, const bool startThread);
+    void stopBackgroundDrain();
+    bool drainReports();
+    void getAggregates(std::vector<MetricStreamerAggregate> &aggregates);
+    // Reports lost since the streamer was opened because readData did not release a host buffer half in time.
+    uint64_t getDroppedReportCount();
+
   protected:
     ze_result_t stopMeasurements();
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
     uint32_t getNotifyEveryNReports(const uint32_t oaBufferSize) const;
     uint32_t getRequiredBufferSize(const uint32_t maxReportCount) const;
 
+    ze_result_t readDrainedData(size_t *pRawDataSize, uint8_t *pRawData);
+    bool swapHostBuffers();
+    void aggregateReports(const uint8_t *pRawData, const size_t rawDataSize);
+    void drainLoop();
+
     ze_device_handle_t hDevice = nullptr;
     zet_metric_group_handle_t hMetricGroup = nullptr;
     Event *pNotificationEvent = nullptr;
     uint32_t rawReportSize = 0;
     uint32_t oaBufferSize = 0;
+
+    // Host side double buffer: the drain thread appends to fillIndex, readData consumes the other one.
+    // Halves are swapped as soon as the consumed one is fully read and the fill one has data,
+    // by readData, or by the drain thread once the fill half is full.
+    bool backgroundDrainEnabled = false;
+    std::mutex drainMutex;
+    std::vector<uint8_t> hostBuffers[2];
+    size_t hostBufferCapacity = 0;
+    uint32_t fillIndex = 0;
+    size_t consumeOffset = 0;
+    uint64_t droppedReportCount = 0;
+    uint64_t reportedDroppedReportCount = 0;
+    std::vector<uint8_t> drainScratch;
+    uint32_t drainTimeoutMs = 1;
+
+    std::vector<zet_typed_value_t> calculatedValues;
+    std::vector<MetricStreamerAggregate> windowAggregates;
+
+    std::thread drainThread;
+    std::condition_variable drainCondition;
+    bool stopDrain = false;
 };
 
 } // namespace L0
\ No newline at end of file
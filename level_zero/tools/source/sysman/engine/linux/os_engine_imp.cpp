@@ -45,6 +45,17 @@ ze_result_t OsEngine::getNumEngineTypeAndInstances(std::multimap<zes_engine_grou
 }
 
 ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
+    if (pmuGroupIndex >= 0) {
+        // All engines of the device share one group sample per poll, pick this engine's counter
+        uint64_t activeTime = 0;
+        uint64_t timeEnabled = 0;
+        if (pPmuInterface->pmuGroupReadCounter(pmuGroupIndex, activeTime, timeEnabled) < 0) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        pStats->activeTime = activeTime / microSecondsToNanoSeconds;
+        pStats->timestamp = timeEnabled / microSecondsToNanoSeconds;
+        return ZE_RESULT_SUCCESS;
+    }
     if (fd < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
@@ -68,7 +79,11 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
 void LinuxEngineImp::init() {
     auto i915EngineClass = engineToI915Map.find(engineGroup);
     // I915_PMU_ENGINE_BUSY macro provides the perf type config which we want to listen to get the engine busyness.
-    fd = pPmuInterface->pmuInterfaceOpen(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    auto config = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
+    pmuGroupIndex = pPmuInterface->pmuGroupAdd(config);
+    if (pmuGroupIndex < 0) {
+        fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    }
 }
 
 LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance) : engineGroup(type), engineInstance(engineInstance) {
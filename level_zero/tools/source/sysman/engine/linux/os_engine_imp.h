@@ -38,6 +38,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
   private:
     void init();
     int64_t fd = -1;
+    int pmuGroupIndex = -1;
 };
 
 } // namespace L0
@@ -10,11 +10,14 @@
 #include <climits>
 
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -37,95 +40,115 @@ FsAccess *FsAccess::create() {
     return new FsAccess();
 }
 
-ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+// sysfs attributes never exceed a page, values read here are much shorter
+static constexpr size_t maxAttributeSize = 4096;
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
+static ze_result_t preadAttribute(int fd, char *buffer, size_t bufferSize) {
+    ssize_t length = 0;
+    do {
+        length = ::pread(fd, buffer, bufferSize - 1, 0);
+    } while (length < 0 && errno == EINTR);
+    if (length < 0) {
         return getResult(errno);
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
+    buffer[length] = '\0';
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
+static ze_result_t readFile(const std::string &file, char *buffer, size_t bufferSize) {
+    int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
         return getResult(errno);
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    ze_result_t result = preadAttribute(fd, buffer, bufferSize);
+    ::close(fd);
+    return result;
 }
 
-ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+static bool parseValue(const char *str, uint64_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    val = std::strtoull(str, &end, 10);
+    return (end != str) && (errno == 0);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+static bool parseValue(const char *str, uint32_t &val) {
+    uint64_t val64 = 0;
+    if (!parseValue(str, val64) || (val64 > std::numeric_limits<uint32_t>::max())) {
+        return false;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    val = static_cast<uint32_t>(val64);
+    return true;
+}
+
+static bool parseValue(const char *str, int32_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    long valLong = std::strtol(str, &end, 10);
+    if ((end == str) || (errno != 0) ||
+        (valLong < std::numeric_limits<int32_t>::min()) || (valLong > std::numeric_limits<int32_t>::max())) {
+        return false;
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    val = static_cast<int32_t>(valLong);
+    return true;
 }
 
-ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+static bool parseValue(const char *str, double &val) {
+    char *end = nullptr;
+    errno = 0;
+    val = std::strtod(str, &end);
+    return (end != str) && (errno == 0);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+static bool parseValue(const char *str, std::string &val) {
+    // Same as extracting with operator>>, first whitespace separated token
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+        str++;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    const char *end = str;
+    while (*end != '\0' && !std::isspace(static_cast<unsigned char>(*end))) {
+        end++;
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    val.assign(str, end);
+    return !val.empty();
 }
-ze_result_t FsAccess::read(const std::string file, std::string &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-    val.clear();
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+template <typename T>
+static ze_result_t readValue(const std::string &file, T &val) {
+    char buffer[maxAttributeSize];
+    ze_result_t result = readFile(file, buffer, sizeof(buffer));
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs.close();
-    // Strip trailing newline
-    if (val.back() == '\n') {
-        val.pop_back();
+    if (!parseValue(buffer, val)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    // Read a single value from text file
+    return readValue(file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, double &val) {
+    return readValue(file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    return readValue(file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    return readValue(file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, std::string &val) {
+    // Read the first word of a text file, without trailing newline
+    val.clear();
+    return readValue(file, val);
+}
+
 ze_result_t FsAccess::read(const std::string file, std::vector<std::string> &val) {
     // Read a entire text file, one line per vector entry
     std::string line;
@@ -294,6 +317,13 @@ std::string ProcfsAccess::fullFdPath(const ::pid_t pid, const int fd) {
     return std::string(fdDirPath(pid) + std::to_string(fd));
 }
 
+static bool isNumericName(const std::string &name, int32_t &val) {
+    if (name.empty() || !std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    return parseValue(name.c_str(), val);
+}
+
 ProcfsAccess *ProcfsAccess::create() {
     return new ProcfsAccess();
 }
@@ -306,15 +336,14 @@ ze_result_t ProcfsAccess::listProcesses(std::vector<::pid_t> &list) {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    list.reserve(dir.size());
     for (auto &&file : dir) {
-        ::pid_t pid;
-        std::istringstream stream(file);
-        stream >> pid;
-        if (stream.fail()) {
+        int32_t pid;
+        if (!isNumericName(file, pid)) {
             // Non numeric filename, not a process, skip
             continue;
         }
-        list.push_back(pid);
+        list.push_back(static_cast<::pid_t>(pid));
     }
     return ZE_RESULT_SUCCESS;
 }
@@ -327,11 +356,10 @@ ze_result_t ProcfsAccess::getFileDescriptors(const ::pid_t pid, std::vector<int>
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    list.reserve(dir.size());
     for (auto &&file : dir) {
-        int fd;
-        std::istringstream stream(file);
-        stream >> fd;
-        if (stream.fail()) {
+        int32_t fd;
+        if (!isNumericName(file, fd)) {
             // Non numeric filename, not a file descriptor
             continue;
         }
@@ -405,81 +433,88 @@ ze_result_t SysfsAccess::getFileMode(const std::string file, ::mode_t &mode) {
     return FsAccess::getFileMode(fullPath(file), mode);
 }
 
-ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
-    // Prepend sysfs directory path and call the base read
-    return FsAccess::read(fullPath(file).c_str(), val);
+SysfsAccess::~SysfsAccess() {
+    closeCachedFileDescriptors();
 }
 
-ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
-    std::string str;
-    ze_result_t result;
+ze_result_t SysfsAccess::readAttribute(const std::string file, char *buffer, size_t bufferSize) {
+    std::string path = fullPath(file);
+    std::lock_guard<std::mutex> lock(cachedFileDescriptorsMutex);
 
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
+    auto cached = cachedFileDescriptors.find(path);
+    if (cached != cachedFileDescriptors.end()) {
+        if (ZE_RESULT_SUCCESS == preadAttribute(cached->second, buffer, bufferSize)) {
+            return ZE_RESULT_SUCCESS;
+        }
+        // Attribute went away (e.g. device unbound), drop stale descriptor and try to reopen it
+        ::close(cached->second);
+        cachedFileDescriptors.erase(cached);
     }
 
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return getResult(errno);
     }
-    return ZE_RESULT_SUCCESS;
-}
-
-ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
+    ze_result_t result = preadAttribute(fd, buffer, bufferSize);
     if (ZE_RESULT_SUCCESS != result) {
+        ::close(fd);
         return result;
     }
 
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
+    if (cachedFileDescriptors.size() >= maxCachedFileDescriptors) {
+        // Per-client attributes come and go, keep the number of open descriptors bounded
+        for (auto &entry : cachedFileDescriptors) {
+            ::close(entry.second);
+        }
+        cachedFileDescriptors.clear();
     }
+    cachedFileDescriptors[path] = fd;
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t SysfsAccess::read(const std::string file, double &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
+void SysfsAccess::closeCachedFileDescriptors() {
+    std::lock_guard<std::mutex> lock(cachedFileDescriptorsMutex);
+    for (auto &entry : cachedFileDescriptors) {
+        ::close(entry.second);
     }
+    cachedFileDescriptors.clear();
+}
 
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
+template <typename T>
+static ze_result_t readCachedValue(ze_result_t readResult, const char *buffer, T &val) {
+    if (ZE_RESULT_SUCCESS != readResult) {
+        return readResult;
+    }
+    if (!parseValue(buffer, val)) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
-    std::string str;
-    ze_result_t result;
+ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
+    char buffer[maxAttributeSize];
+    val.clear();
+    return readCachedValue(readAttribute(file, buffer, sizeof(buffer)), buffer, val);
+}
 
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
+ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
+    char buffer[maxAttributeSize];
+    return readCachedValue(readAttribute(file, buffer, sizeof(buffer)), buffer, val);
+}
 
-    std::istringstream stream(str);
-    stream >> val;
+ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
+    char buffer[maxAttributeSize];
+    return readCachedValue(readAttribute(file, buffer, sizeof(buffer)), buffer, val);
+}
 
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+ze_result_t SysfsAccess::read(const std::string file, double &val) {
+    char buffer[maxAttributeSize];
+    return readCachedValue(readAttribute(file, buffer, sizeof(buffer)), buffer, val);
+}
+
+ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
+    char buffer[maxAttributeSize];
+    return readCachedValue(readAttribute(file, buffer, sizeof(buffer)), buffer, val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
@@ -538,10 +573,12 @@ ze_result_t SysfsAccess::getRealPath(const std::string path, std::string &val) {
 }
 
 ze_result_t SysfsAccess::bindDevice(std::string device) {
+    closeCachedFileDescriptors();
     return FsAccess::write(intelGpuBindEntry, device);
 }
 
 ze_result_t SysfsAccess::unbindDevice(std::string device) {
+    closeCachedFileDescriptors();
     return FsAccess::write(intelGpuUnbindEntry, device);
 }
 
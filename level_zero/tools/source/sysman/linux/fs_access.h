@@ -13,6 +13,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -79,7 +81,7 @@ class SysfsAccess : private FsAccess {
   public:
     static SysfsAccess *create(const std::string file);
     SysfsAccess() = default;
-    ~SysfsAccess() override = default;
+    ~SysfsAccess() override;
 
     ze_result_t canRead(const std::string file) override;
     ze_result_t canWrite(const std::string file) override;
@@ -106,6 +108,16 @@ class SysfsAccess : private FsAccess {
     MOCKABLE_VIRTUAL bool fileExists(const std::string file) override;
     MOCKABLE_VIRTUAL bool isMyDeviceFile(const std::string dev);
 
+  protected:
+    // Attribute files stay open after the first read and are re-read with pread at offset 0,
+    // which makes sysfs regenerate their contents.
+    static constexpr size_t maxCachedFileDescriptors = 256;
+    ze_result_t readAttribute(const std::string file, char *buffer, size_t bufferSize);
+    void closeCachedFileDescriptors();
+
+    std::mutex cachedFileDescriptorsMutex;
+    std::map<std::string, int> cachedFileDescriptors;
+
   private:
     SysfsAccess(const std::string file);
 
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <cstdint>
+#include <vector>
 
 namespace L0 {
 class LinuxSysmanImp;
@@ -15,6 +16,13 @@ class PmuInterface {
     virtual ~PmuInterface() = default;
     virtual int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) = 0;
     virtual int pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) = 0;
+    // Counters added to the device group are sampled together with a single read.
+    // pmuGroupAdd returns index of the counter in values returned by pmuGroupRead, negative on failure.
+    virtual int pmuGroupAdd(uint64_t config) = 0;
+    virtual int pmuGroupRead(std::vector<uint64_t> &values, uint64_t &timeEnabled) = 0;
+    // Returns one member's counter from a group sample shared by all members. The group is read again only when
+    // a member asks for a value it already got from the current sample, so polling every engine costs one read.
+    virtual int pmuGroupReadCounter(int groupIndex, uint64_t &value, uint64_t &timeEnabled) = 0;
     static PmuInterface *create(LinuxSysmanImp *pLinuxSysmanImp);
 };
 
@@ -81,6 +81,71 @@ int PmuInterfaceImp::pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) {
     return 0;
 }
 
+int PmuInterfaceImp::pmuGroupAdd(uint64_t config) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    // First counter becomes the group leader, reads on the leader return values of all members
+    int groupLeaderFd = groupFds.empty() ? -1 : static_cast<int>(groupFds[0]);
+    int64_t fd = pmuInterfaceOpen(config, groupLeaderFd, groupReadFormat);
+    if (fd < 0) {
+        return -1;
+    }
+    groupFds.push_back(fd);
+    groupSampleValid = false;
+    return static_cast<int>(groupFds.size() - 1);
+}
+
+int PmuInterfaceImp::readGroupSample() {
+    groupSampleValid = false;
+    if (groupFds.empty()) {
+        return -1;
+    }
+    // With PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED read returns:
+    // u64 nr; u64 time_enabled; u64 values[nr];
+    groupReadBuffer.resize(groupReadHeaderSize + groupFds.size());
+    if (pmuReadSingle(static_cast<int>(groupFds[0]), groupReadBuffer.data(), groupReadBuffer.size() * sizeof(uint64_t)) < 0) {
+        return -1;
+    }
+    if (groupReadBuffer[0] != groupFds.size()) {
+        return -1;
+    }
+    groupSampleConsumed.assign(groupFds.size(), false);
+    groupSampleValid = true;
+    return 0;
+}
+
+int PmuInterfaceImp::pmuGroupRead(std::vector<uint64_t> &values, uint64_t &timeEnabled) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    if (readGroupSample() < 0) {
+        return -1;
+    }
+    timeEnabled = groupReadBuffer[1];
+    values.assign(groupReadBuffer.begin() + groupReadHeaderSize, groupReadBuffer.end());
+    return 0;
+}
+
+int PmuInterfaceImp::pmuGroupReadCounter(int groupIndex, uint64_t &value, uint64_t &timeEnabled) {
+    std::lock_guard<std::mutex> lock(groupMutex);
+    if ((groupIndex < 0) || (static_cast<size_t>(groupIndex) >= groupFds.size())) {
+        return -1;
+    }
+    if (!groupSampleValid || groupSampleConsumed[groupIndex]) {
+        if (readGroupSample() < 0) {
+            return -1;
+        }
+    }
+    groupSampleConsumed[groupIndex] = true;
+    timeEnabled = groupReadBuffer[1];
+    value = groupReadBuffer[groupReadHeaderSize + groupIndex];
+    return 0;
+}
+
+PmuInterfaceImp::~PmuInterfaceImp() {
+    // Members are closed before the group leader
+    for (auto fd = groupFds.rbegin(); fd != groupFds.rend(); ++fd) {
+        close(static_cast<int>(*fd));
+    }
+}
+
 PmuInterfaceImp::PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
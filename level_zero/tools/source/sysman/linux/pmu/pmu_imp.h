@@ -10,8 +10,10 @@
 #include "level_zero/tools/source/sysman/linux/pmu/pmu.h"
 
 #include <linux/perf_event.h>
+#include <mutex>
 #include <string>
 #include <sys/sysinfo.h>
+#include <vector>
 
 namespace L0 {
 
@@ -19,12 +21,24 @@ class PmuInterfaceImp : public PmuInterface, NEO::NonCopyableOrMovableClass {
   public:
     PmuInterfaceImp() = delete;
     PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp);
-    ~PmuInterfaceImp() override = default;
+    ~PmuInterfaceImp() override;
     int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override;
     MOCKABLE_VIRTUAL int pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) override;
+    int pmuGroupAdd(uint64_t config) override;
+    int pmuGroupRead(std::vector<uint64_t> &values, uint64_t &timeEnabled) override;
+    int pmuGroupReadCounter(int groupIndex, uint64_t &value, uint64_t &timeEnabled) override;
 
   protected:
     MOCKABLE_VIRTUAL int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags);
+    static constexpr uint32_t groupReadFormat = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED;
+    static constexpr size_t groupReadHeaderSize = 2;
+    int readGroupSample();
+
+    std::mutex groupMutex;
+    std::vector<int64_t> groupFds;
+    std::vector<uint64_t> groupReadBuffer;
+    std::vector<bool> groupSampleConsumed;
+    bool groupSampleValid = false;
 
   private:
     uint32_t getEventType();
@@ -9,6 +9,7 @@
 
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_driver.h"
+#include "level_zero/tools/source/metrics/metric_streamer_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric.h"
 
 #include "gmock/gmock.h"
@@ -1003,5 +1004,145 @@ TEST_F(MetricStreamerTest, givenMultipleMarkerInsertionsWhenZetCommandListAppend
     EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
 }
 
+struct DrainingMetricStreamer : public MetricStreamerImp {
+    using MetricStreamerImp::droppedReportCount;
+    using MetricStreamerImp::hostBufferCapacity;
+    using MetricStreamerImp::oaBufferSize;
+};
+
+TEST_F(MetricStreamerTest, givenBackgroundDrainWhenReportsAreDrainedThenReadDataReturnsThemInOrderAndAggregatesAreCalculated) {
+
+    const uint32_t rawReportSize = 4;
+    uint8_t nextByte = 0;
+
+    Mock<MetricGroup> metricGroup;
+    zet_metric_group_properties_t metricGroupProperties = {};
+    metricGroupProperties.metricCount = 1;
+
+    EXPECT_CALL(metricGroup, getRawReportSize())
+        .WillRepeatedly(Return(rawReportSize));
+
+    EXPECT_CALL(metricGroup, getProperties(_))
+        .WillRepeatedly(DoAll(::testing::SetArgPointee<0>(metricGroupProperties), Return(ZE_RESULT_SUCCESS)));
+
+    EXPECT_CALL(metricGroup, readIoStream(_, _))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke([&](uint32_t &reportCount, uint8_t &reportData) {
+            reportCount = 3;
+            for (uint32_t i = 0; i < reportCount * rawReportSize; i++) {
+                (&reportData)[i] = nextByte++;
+            }
+            return ZE_RESULT_SUCCESS;
+        }));
+
+    // Every report yields one metric equal to its first byte.
+    EXPECT_CALL(metricGroup, calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, _, _, _, _))
+        .WillRepeatedly(::testing::Invoke([&](const zet_metric_group_calculation_type_t, size_t rawDataSize, const uint8_t *pRawData,
+                                              uint32_t *pMetricValueCount, zet_typed_value_t *pMetricValues) {
+            *pMetricValueCount = static_cast<uint32_t>(rawDataSize / rawReportSize);
+            for (uint32_t i = 0; pMetricValues != nullptr && i < *pMetricValueCount; i++) {
+                pMetricValues[i].type = ZET_VALUE_TYPE_UINT32;
+                pMetricValues[i].value.ui32 = pRawData[i * rawReportSize];
+            }
+            return ZE_RESULT_SUCCESS;
+        }));
+
+    DrainingMetricStreamer streamer;
+    streamer.initialize(device->toHandle(), metricGroup.toHandle());
+    streamer.oaBufferSize = 4 * rawReportSize;
+    streamer.startBackgroundDrain(2, 0, false);
+    EXPECT_EQ(streamer.oaBufferSize, streamer.hostBufferCapacity);
+    EXPECT_EQ(Event::State::STATE_INITIAL, streamer.getNotificationState());
+
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_EQ(Event::State::STATE_SIGNALED, streamer.getNotificationState());
+
+    std::vector<MetricStreamerAggregate> aggregates;
+    streamer.getAggregates(aggregates);
+    ASSERT_EQ(1u, aggregates.size());
+    EXPECT_EQ(3u, aggregates[0].sampleCount);
+    EXPECT_DOUBLE_EQ(0.0, aggregates[0].minimum);
+    EXPECT_DOUBLE_EQ(8.0, aggregates[0].maximum);
+    EXPECT_DOUBLE_EQ(4.0, aggregates[0].average);
+
+    streamer.getAggregates(aggregates);
+    EXPECT_EQ(0u, aggregates[0].sampleCount);
+
+    // Host buffer half holds four reports, the rest of the second batch goes to the other half.
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_EQ(0u, streamer.getDroppedReportCount());
+
+    uint8_t rawData[64] = {};
+    size_t rawSize = sizeof(rawData);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, streamer.readData(16, &rawSize, rawData));
+    EXPECT_EQ(6u * rawReportSize, rawSize);
+    for (uint8_t i = 0; i < rawSize; i++) {
+        EXPECT_EQ(i, rawData[i]);
+    }
+    EXPECT_EQ(Event::State::STATE_INITIAL, streamer.getNotificationState());
+
+    rawSize = sizeof(rawData);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, streamer.readData(16, &rawSize, rawData));
+    EXPECT_EQ(0u, rawSize);
+}
+
+TEST_F(MetricStreamerTest, givenBackgroundDrainWhenBothHostBufferHalvesAreFullThenNewestReportsAreDroppedUntilConsumerReleasesHalf) {
+
+    const uint32_t rawReportSize = 4;
+    uint8_t nextByte = 0;
+
+    Mock<MetricGroup> metricGroup;
+    zet_metric_group_properties_t metricGroupProperties = {};
+
+    EXPECT_CALL(metricGroup, getRawReportSize())
+        .WillRepeatedly(Return(rawReportSize));
+
+    EXPECT_CALL(metricGroup, getProperties(_))
+        .WillRepeatedly(DoAll(::testing::SetArgPointee<0>(metricGroupProperties), Return(ZE_RESULT_SUCCESS)));
+
+    EXPECT_CALL(metricGroup, readIoStream(_, _))
+        .Times(4)
+        .WillRepeatedly(::testing::Invoke([&](uint32_t &reportCount, uint8_t &reportData) {
+            reportCount = 3;
+            for (uint32_t i = 0; i < reportCount * rawReportSize; i++) {
+                (&reportData)[i] = nextByte++;
+            }
+            return ZE_RESULT_SUCCESS;
+        }));
+
+    DrainingMetricStreamer streamer;
+    streamer.initialize(device->toHandle(), metricGroup.toHandle());
+    streamer.oaBufferSize = 4 * rawReportSize;
+    streamer.startBackgroundDrain(2, 0, false);
+
+    // Reports 0-3 fill the first half, which is handed to the consumer, reports 4-7 fill the second one.
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_EQ(0u, streamer.getDroppedReportCount());
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_EQ(1u, streamer.getDroppedReportCount());
+
+    uint8_t rawData[64] = {};
+    size_t rawSize = 2 * rawReportSize;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, streamer.readData(16, &rawSize, rawData));
+    EXPECT_EQ(2u * rawReportSize, rawSize);
+
+    // Consumer still holds the first half.
+    EXPECT_TRUE(streamer.drainReports());
+    EXPECT_EQ(4u, streamer.getDroppedReportCount());
+
+    rawSize = 2 * rawReportSize;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, streamer.readData(16, &rawSize, rawData + 2 * rawReportSize));
+    EXPECT_EQ(2u * rawReportSize, rawSize);
+
+    rawSize = sizeof(rawData) - 4 * rawReportSize;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, streamer.readData(16, &rawSize, rawData + 4 * rawReportSize));
+    EXPECT_EQ(4u * rawReportSize, rawSize);
+    for (uint8_t i = 0; i < 8 * rawReportSize; i++) {
+        EXPECT_EQ(i, rawData[i]);
+    }
+    EXPECT_EQ(Event::State::STATE_INITIAL, streamer.getNotificationState());
+}
+
 } // namespace ult
 } // namespace L0
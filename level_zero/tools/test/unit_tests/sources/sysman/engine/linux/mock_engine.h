@@ -63,6 +63,7 @@ struct Mock<EngineNeoDrm> : public EngineNeoDrm {
 
 class MockPmuInterfaceImp : public PmuInterfaceImp {
   public:
+    using PmuInterfaceImp::groupFds;
     using PmuInterfaceImp::perfEventOpen;
     MockPmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {}
 };
@@ -76,10 +77,29 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
         return -1;
     }
     int mockedPmuReadSingleAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
+        auto numValues = sizeOfdata / sizeof(uint64_t);
+        if (numValues > 2) {
+            // Group read: nr, time enabled, values[nr]
+            data[0] = numValues - 2;
+            data[1] = mockTimestamp;
+            for (auto i = 2u; i < numValues; i++) {
+                data[i] = mockActiveTime;
+            }
+            return 0;
+        }
         data[0] = mockActiveTime;
         data[1] = mockTimestamp;
         return 0;
     }
+    int mockedPmuReadGroupWithDistinctValuesReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
+        auto numValues = sizeOfdata / sizeof(uint64_t);
+        data[0] = numValues - 2;
+        data[1] = mockTimestamp;
+        for (auto i = 2u; i < numValues; i++) {
+            data[i] = (i - 1) * microSecondsToNanoSeconds;
+        }
+        return 0;
+    }
     int mockedPmuReadSingleAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
         return -1;
     }
@@ -179,6 +179,57 @@ TEST_F(ZesEngineFixture, GivenTestIntegratedDevicesAndValidEngineHandleWhenCalli
     delete pOsEngineTest1;
 }
 
+TEST_F(ZesEngineFixture, GivenValidEngineHandlesWhenCallingZesEngineGetActivityThenAllEnginesAreSampledFromOnePmuGroupRead) {
+    ON_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupWithDistinctValuesReturn));
+    EXPECT_EQ(handleComponentCount, pPmuInterface->groupFds.size());
+
+    zes_engine_stats_t stats = {};
+    auto handles = getEngineHandles(handleComponentCount);
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, static_cast<ssize_t>((2 + handleComponentCount) * sizeof(uint64_t)))).Times(1);
+    for (auto i = 0u; i < handleComponentCount; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[i], &stats));
+        EXPECT_EQ(i + 1, stats.activeTime);
+        EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+    }
+    ::testing::Mock::VerifyAndClearExpectations(pPmuInterface.get());
+
+    // next poll of any engine takes a fresh sample
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _)).Times(1);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[1], &stats));
+}
+
+TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenPollingSameEngineTwiceThenPmuGroupIsReadForEachPoll) {
+    auto handles = getEngineHandles(handleComponentCount);
+    zes_engine_stats_t stats = {};
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _)).Times(2);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+}
+
+TEST_F(ZesEngineFixture, GivenPmuGroupWhenReadingWholeGroupThenValuesOfAllMembersAreReturned) {
+    ON_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
+        .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadGroupWithDistinctValuesReturn));
+    std::vector<uint64_t> values;
+    uint64_t timeEnabled = 0;
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, static_cast<ssize_t>((2 + handleComponentCount) * sizeof(uint64_t)))).Times(1);
+    EXPECT_EQ(0, pPmuInterface->pmuGroupRead(values, timeEnabled));
+    EXPECT_EQ(handleComponentCount, values.size());
+    EXPECT_EQ(mockTimestamp, timeEnabled);
+
+    uint64_t value = 0;
+    EXPECT_EQ(-1, pPmuInterface->pmuGroupReadCounter(static_cast<int>(handleComponentCount), value, timeEnabled));
+    EXPECT_EQ(-1, pPmuInterface->pmuGroupReadCounter(-1, value, timeEnabled));
+}
+
+TEST_F(ZesEngineFixture, GivenPmuGroupWithoutCountersWhenReadingGroupThenFailureIsReturned) {
+    Mock<MockPmuInterfaceImp> pmuInterface(pLinuxSysmanImp);
+    std::vector<uint64_t> values;
+    uint64_t timeEnabled = 0;
+    EXPECT_EQ(-1, pmuInterface.pmuGroupRead(values, timeEnabled));
+}
+
 TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenCallingZesEngineGetActivityAndPmuReadSingleFailsThenVerifyEngineGetActivityReturnsFailure) {
     ON_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, _))
         .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadSingleAndFailureReturn));
@@ -9,6 +9,12 @@
 
 #include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <unistd.h>
+
 namespace L0 {
 namespace ult {
 
@@ -123,5 +129,95 @@ TEST_F(SysmanMultiDeviceFixture, GivenValidDeviceHandleHavingSubdevicesWhenValid
     }
 }
 
+class PublicSysfsAccess : public L0::SysfsAccess {
+  public:
+    using SysfsAccess::cachedFileDescriptors;
+};
+
+// Real files are needed to exercise descriptor caching and value parsing,
+// they are created in a private temporary directory removed after each test
+class SysmanTempDirTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/neo_sysman_ult_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        tempDir = dirTemplate;
+    }
+
+    void TearDown() override {
+        for (auto &file : createdFiles) {
+            std::remove(file.c_str());
+        }
+        if (!tempDir.empty()) {
+            rmdir(tempDir.c_str());
+        }
+    }
+
+    std::string writeFile(const std::string &name, const std::string &contents) {
+        std::string path = tempDir + "/" + name;
+        std::ofstream(path, std::ios::trunc) << contents;
+        createdFiles.insert(path);
+        return path;
+    }
+
+    std::string tempDir;
+    std::set<std::string> createdFiles;
+};
+
+using SysfsAccessTest = SysmanTempDirTest;
+TEST_F(SysfsAccessTest, GivenAttributeReadTwiceWhenFileContentsChangeThenCachedFileDescriptorIsReusedAndNewValueIsReturned) {
+    std::string fileName = writeFile("sysfs_access_test_attribute", "123\n");
+
+    PublicSysfsAccess sysfsAccess;
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.read(fileName, val));
+    EXPECT_EQ(123u, val);
+    EXPECT_EQ(1u, sysfsAccess.cachedFileDescriptors.size());
+
+    writeFile("sysfs_access_test_attribute", "456\n");
+    std::string str;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.read(fileName, str));
+    EXPECT_EQ("456", str);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, sysfsAccess.read(fileName, val));
+    EXPECT_EQ(456u, val);
+    EXPECT_EQ(1u, sysfsAccess.cachedFileDescriptors.size());
+}
+
+TEST_F(SysfsAccessTest, GivenMissingAttributeWhenReadingThenNotAvailableIsReturnedAndNothingIsCached) {
+    PublicSysfsAccess sysfsAccess;
+    uint32_t val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, sysfsAccess.read(tempDir + "/noSuchFileOrDirectory", val));
+    EXPECT_TRUE(sysfsAccess.cachedFileDescriptors.empty());
+}
+
+using FsAccessTest = SysmanTempDirTest;
+TEST_F(FsAccessTest, GivenTextFilesWhenReadingValuesThenValuesAreParsedWithoutTrailingWhitespace) {
+    std::unique_ptr<FsAccess> fsAccess(FsAccess::create());
+    std::string fileName = writeFile("fs_access_test_value", "  -42\n");
+
+    int32_t intVal = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess->read(fileName, intVal));
+    EXPECT_EQ(-42, intVal);
+
+    writeFile("fs_access_test_value", "1.5\n");
+    double doubleVal = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess->read(fileName, doubleVal));
+    EXPECT_EQ(1.5, doubleVal);
+
+    writeFile("fs_access_test_value", "i915 extra\n");
+    std::string strVal;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess->read(fileName, strVal));
+    EXPECT_EQ("i915", strVal);
+
+    uint64_t uint64Val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, fsAccess->read(fileName, uint64Val));
+
+    writeFile("fs_access_test_value", "4294967296\n");
+    uint32_t uint32Val = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, fsAccess->read(fileName, uint32Val));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fsAccess->read(fileName, uint64Val));
+    EXPECT_EQ(4294967296u, uint64Val);
+}
+
 } // namespace ult
 } // namespace L0
@@ -178,3 +178,19 @@ typedef struct _cl_queue_family_properties_intel {
     cl_command_queue_capabilities_intel capabilities;
     cl_uint count;
 } cl_queue_family_properties_intel;
+
+/******************************
+*     BATCHED KERNEL ENQUEUE  *
+*******************************/
+
+// clEnqueueNDRangeKernelsINTEL submits kernels sharing dispatch settings together, kernels within such group are not ordered.
+// Kernels differing in dispatch settings or needing own cache flush are submitted in order after the previous group.
+// Returns CL_INVALID_KERNEL for kernels using printf, sync buffer, aux translation, debug surface, device enqueue,
+// builtin dispatch or concurrent execution type.
+typedef struct _cl_ndrange_kernel_desc_intel {
+    cl_kernel kernel;
+    cl_uint workDim;
+    const size_t *globalWorkOffset;
+    const size_t *globalWorkSize;
+    const size_t *localWorkSize;
+} cl_ndrange_kernel_desc_intel;
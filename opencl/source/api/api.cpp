@@ -4295,6 +4295,7 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelMaxConcurrentWorkGroupCountINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelSuggestedLocalWorkSizeINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDCountKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDRangeKernelsINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -5857,6 +5858,75 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(cl_command_queue commandQueue,
     return retVal;
 }
 
+cl_int CL_API_CALL clEnqueueNDRangeKernelsINTEL(cl_command_queue commandQueue,
+                                                cl_uint numKernels,
+                                                const cl_ndrange_kernel_desc_intel *kernelDescs,
+                                                cl_uint numEventsInWaitList,
+                                                const cl_event *eventWaitList,
+                                                cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue,
+                   "numKernels", numKernels,
+                   "kernelDescs", kernelDescs,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    CommandQueue *pCommandQueue = nullptr;
+
+    retVal = validateObjects(
+        WithCastToInternal(commandQueue, &pCommandQueue),
+        EventWaitList(numEventsInWaitList, eventWaitList));
+
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    if (numKernels == 0 || kernelDescs == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    for (cl_uint i = 0; i < numKernels; i++) {
+        Kernel *pKernel = nullptr;
+        retVal = validateObjects(WithCastToInternal(kernelDescs[i].kernel, &pKernel));
+        if (CL_SUCCESS != retVal) {
+            return retVal;
+        }
+        if ((kernelDescs[i].workDim < 1) || (kernelDescs[i].workDim > 3) || (kernelDescs[i].globalWorkSize == nullptr)) {
+            retVal = CL_INVALID_VALUE;
+            return retVal;
+        }
+        if ((pKernel->getExecutionType() != KernelExecutionType::Default) ||
+            pKernel->isUsingSyncBuffer()) {
+            retVal = CL_INVALID_KERNEL;
+            return retVal;
+        }
+    }
+
+    if (!pCommandQueue->validateCapabilityForOperation(CL_QUEUE_CAPABILITY_KERNEL_INTEL, eventWaitList, event)) {
+        retVal = CL_INVALID_OPERATION;
+        return retVal;
+    }
+
+    if (gtpinIsGTPinInitialized()) {
+        for (cl_uint i = 0; i < numKernels; i++) {
+            gtpinNotifyKernelSubmit(kernelDescs[i].kernel, pCommandQueue);
+        }
+    }
+
+    retVal = pCommandQueue->enqueueKernels(
+        numKernels,
+        kernelDescs,
+        numEventsInWaitList,
+        eventWaitList,
+        event);
+
+    DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
+    return retVal;
+}
+
 cl_int CL_API_CALL clSetContextDestructorCallback(cl_context context,
                                                   void(CL_CALLBACK *pfnNotify)(cl_context /* context */, void * /* user_data */),
                                                   void *userData) {
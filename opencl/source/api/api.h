@@ -1059,6 +1059,14 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(
     const cl_event *eventWaitList,
     cl_event *event);
 
+cl_int CL_API_CALL clEnqueueNDRangeKernelsINTEL(
+    cl_command_queue commandQueue,
+    cl_uint numKernels,
+    const cl_ndrange_kernel_desc_intel *kernelDescs,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
 // OpenCL 2.2
 
 cl_int CL_API_CALL clSetProgramReleaseCallback(
@@ -7,10 +7,14 @@
 
 #include "shared/source/utilities/perf_profiler.h"
 
+#include "opencl/source/utilities/binary_api_tracer.h"
 #include "opencl/source/utilities/logger.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+// args of the binary API trace record come from TRACING_ENTER of the same function
+#define API_ENTER(retValPointer)                                                                                                         \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    static const uint32_t binaryApiTraceFunctionId = NEO::BinaryApiTracer::registerFunction(__FUNCTION__);                               \
+    NEO::BinaryApiTraceScope binaryApiTraceScopeForSingleCall(binaryApiTraceFunctionId, __FUNCTION__, retValPointer)
 
 #if KMD_PROFILING == 1
 #undef API_ENTER
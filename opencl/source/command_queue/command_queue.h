@@ -88,6 +88,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     virtual cl_int enqueueKernel(cl_kernel kernel, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
                                  const size_t *localWorkSize, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) = 0;
 
+    virtual cl_int enqueueKernels(cl_uint numKernels, const cl_ndrange_kernel_desc_intel *kernelDescs,
+                                  cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) = 0;
+
     virtual cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) = 0;
 
     MOCKABLE_VIRTUAL void *enqueueMapBuffer(Buffer *buffer, cl_bool blockingMap,
@@ -28,6 +28,19 @@ namespace NEO {
 class EventBuilder;
 struct EnqueueProperties;
 
+struct KernelDispatchGeometry {
+    KernelDispatchGeometry() = default;
+    KernelDispatchGeometry(const KernelDispatchGeometry &) = delete;
+    KernelDispatchGeometry &operator=(const KernelDispatchGeometry &) = delete;
+
+    size_t region[3] = {1, 1, 1};
+    size_t globalWorkOffset[3] = {0, 0, 0};
+    size_t workGroupSize[3] = {1, 1, 1};
+    size_t enqueuedLocalWorkSize[3] = {0, 0, 0};
+    size_t requiredWorkgroupSize[3] = {0, 0, 0};
+    const size_t *localWorkSizeToPass = nullptr;
+};
+
 template <typename GfxFamily>
 class CommandQueueHw : public CommandQueue {
     using BaseClass = CommandQueue;
@@ -153,6 +166,12 @@ class CommandQueueHw : public CommandQueue {
                          const cl_event *eventWaitList,
                          cl_event *event) override;
 
+    cl_int enqueueKernels(cl_uint numKernels,
+                          const cl_ndrange_kernel_desc_intel *kernelDescs,
+                          cl_uint numEventsInWaitList,
+                          const cl_event *eventWaitList,
+                          cl_event *event) override;
+
     cl_int enqueueSVMMap(cl_bool blockingMap,
                          cl_map_flags mapFlags,
                          void *svmPtr,
@@ -409,6 +428,14 @@ class CommandQueueHw : public CommandQueue {
 
   protected:
     MOCKABLE_VIRTUAL void enqueueHandlerHook(const unsigned int commandType, const MultiDispatchInfo &dispatchInfo){};
+    cl_int validateKernelDispatch(Kernel &kernel,
+                                  cl_uint workDim,
+                                  const size_t *globalWorkOffsetIn,
+                                  const size_t *globalWorkSizeIn,
+                                  const size_t *localWorkSizeIn,
+                                  KernelDispatchGeometry &geometry);
+    bool isKernelBatchable(Kernel &kernel);
+    bool canAppendToKernelBatch(const Kernel &batchFirstKernel, const Kernel &kernel);
     size_t calculateHostPtrSizeForImage(const size_t *region, size_t rowPitch, size_t slicePitch, Image *image);
 
     cl_int enqueueReadWriteBufferOnCpuWithMemoryTransfer(cl_command_type commandType, Buffer *buffer,
@@ -487,6 +514,6 @@ class CommandQueueHw : public CommandQueue {
                                    TimestampPacketDependencies &timestampPacketDependencies);
 
     bool isGpgpuSubmissionForBcsRequired(bool queueBlocked) const;
-    void setupEvent(EventBuilder &eventBuilder, cl_event *outEvent, uint32_t cmdType);
+    MOCKABLE_VIRTUAL void setupEvent(EventBuilder &eventBuilder, cl_event *outEvent, uint32_t cmdType);
 };
 } // namespace NEO
@@ -11,32 +11,25 @@
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/command_queue/gpgpu_walker.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/helpers/dispatch_info_builder.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/memory_manager/mem_obj_surface.h"
 
+#include <memory>
 #include <new>
 
 namespace NEO {
 
 template <typename GfxFamily>
-cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
-    cl_kernel clKernel,
-    cl_uint workDim,
-    const size_t *globalWorkOffsetIn,
-    const size_t *globalWorkSizeIn,
-    const size_t *localWorkSizeIn,
-    cl_uint numEventsInWaitList,
-    const cl_event *eventWaitList,
-    cl_event *event) {
-
-    size_t region[3] = {1, 1, 1};
-    size_t globalWorkOffset[3] = {0, 0, 0};
-    size_t workGroupSize[3] = {1, 1, 1};
-    size_t enqueuedLocalWorkSize[3] = {0, 0, 0};
-
-    auto &kernel = *castToObjectOrAbort<Kernel>(clKernel);
+cl_int CommandQueueHw<GfxFamily>::validateKernelDispatch(Kernel &kernel,
+                                                         cl_uint workDim,
+                                                         const size_t *globalWorkOffsetIn,
+                                                         const size_t *globalWorkSizeIn,
+                                                         const size_t *localWorkSizeIn,
+                                                         KernelDispatchGeometry &geometry) {
     const auto &kernelInfo = kernel.getKernelInfo();
 
     if (kernel.isParentKernel && !this->context->getDefaultDeviceQueue()) {
@@ -44,10 +37,6 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
     }
 
     if (!kernel.isPatched()) {
-        if (event) {
-            *event = nullptr;
-        }
-
         return CL_INVALID_KERNEL_ARGS;
     }
 
@@ -63,17 +52,16 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
 
     size_t remainder = 0;
     size_t totalWorkItems = 1u;
-    const size_t *localWkgSizeToPass = localWorkSizeIn ? workGroupSize : nullptr;
-    size_t reqdWorkgroupSize[3] = {};
+    geometry.localWorkSizeToPass = localWorkSizeIn ? geometry.workGroupSize : nullptr;
 
     for (auto i = 0u; i < workDim; i++) {
-        region[i] = globalWorkSizeIn ? globalWorkSizeIn[i] : 0;
-        if (region[i] == 0 && (kernel.getDevices()[0]->areOcl21FeaturesEnabled() == false)) {
+        geometry.region[i] = globalWorkSizeIn ? globalWorkSizeIn[i] : 0;
+        if (geometry.region[i] == 0 && (kernel.getDevices()[0]->areOcl21FeaturesEnabled() == false)) {
             return CL_INVALID_GLOBAL_WORK_SIZE;
         }
-        globalWorkOffset[i] = globalWorkOffsetIn
-                                  ? globalWorkOffsetIn[i]
-                                  : 0;
+        geometry.globalWorkOffset[i] = globalWorkOffsetIn
+                                           ? globalWorkOffsetIn[i]
+                                           : 0;
 
         if (localWorkSizeIn) {
             if (haveRequiredWorkGroupSize) {
@@ -85,15 +73,15 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
                 return CL_INVALID_WORK_GROUP_SIZE;
             }
             if (kernel.getAllowNonUniform()) {
-                workGroupSize[i] = std::min(localWorkSizeIn[i], std::max(static_cast<size_t>(1), globalWorkSizeIn[i]));
+                geometry.workGroupSize[i] = std::min(localWorkSizeIn[i], std::max(static_cast<size_t>(1), globalWorkSizeIn[i]));
             } else {
-                workGroupSize[i] = localWorkSizeIn[i];
+                geometry.workGroupSize[i] = localWorkSizeIn[i];
             }
-            enqueuedLocalWorkSize[i] = localWorkSizeIn[i];
+            geometry.enqueuedLocalWorkSize[i] = localWorkSizeIn[i];
             totalWorkItems *= localWorkSizeIn[i];
         }
 
-        remainder += region[i] % workGroupSize[i];
+        remainder += geometry.region[i] % geometry.workGroupSize[i];
     }
 
     if (remainder != 0 && !kernel.getAllowNonUniform()) {
@@ -101,15 +89,12 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
     }
 
     if (haveRequiredWorkGroupSize) {
-        reqdWorkgroupSize[0] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0];
-        reqdWorkgroupSize[1] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[1];
-        reqdWorkgroupSize[2] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[2];
-        localWkgSizeToPass = reqdWorkgroupSize;
+        geometry.requiredWorkgroupSize[0] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0];
+        geometry.requiredWorkgroupSize[1] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[1];
+        geometry.requiredWorkgroupSize[2] = kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[2];
+        geometry.localWorkSizeToPass = geometry.requiredWorkgroupSize;
     }
 
-    NullSurface s;
-    Surface *surfaces[] = {&s};
-
     if (context->isProvidingPerformanceHints()) {
         if (kernel.hasPrintfOutput()) {
             context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, PRINTF_DETECTED_IN_KERNEL, kernel.getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
@@ -120,7 +105,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
     }
 
     if (kernel.getKernelInfo().builtinDispatchBuilder != nullptr) {
-        cl_int err = kernel.getKernelInfo().builtinDispatchBuilder->validateDispatch(&kernel, workDim, Vec3<size_t>(region), Vec3<size_t>(workGroupSize), Vec3<size_t>(globalWorkOffset));
+        cl_int err = kernel.getKernelInfo().builtinDispatchBuilder->validateDispatch(&kernel, workDim, Vec3<size_t>(geometry.region), Vec3<size_t>(geometry.workGroupSize), Vec3<size_t>(geometry.globalWorkOffset));
         if (err != CL_SUCCESS)
             return err;
     }
@@ -138,19 +123,146 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         return CL_INVALID_WORK_GROUP_SIZE;
     }
 
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
+    cl_kernel clKernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffsetIn,
+    const size_t *globalWorkSizeIn,
+    const size_t *localWorkSizeIn,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    auto &kernel = *castToObjectOrAbort<Kernel>(clKernel);
+    KernelDispatchGeometry geometry;
+
+    auto retVal = validateKernelDispatch(kernel, workDim, globalWorkOffsetIn, globalWorkSizeIn, localWorkSizeIn, geometry);
+    if (retVal != CL_SUCCESS) {
+        if (retVal == CL_INVALID_KERNEL_ARGS && event) {
+            *event = nullptr;
+        }
+        return retVal;
+    }
+
+    NullSurface s;
+    Surface *surfaces[] = {&s};
+
     enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
         surfaces,
         false,
         &kernel,
         workDim,
-        globalWorkOffset,
-        region,
-        localWkgSizeToPass,
-        enqueuedLocalWorkSize,
+        geometry.globalWorkOffset,
+        geometry.region,
+        geometry.localWorkSizeToPass,
+        geometry.enqueuedLocalWorkSize,
         numEventsInWaitList,
         eventWaitList,
         event);
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::isKernelBatchable(Kernel &kernel) {
+    return !(kernel.isParentKernel ||
+             kernel.hasPrintfOutput() ||
+             kernel.usesSyncBuffer() ||
+             kernel.isAuxTranslationRequired() ||
+             kernel.isKernelDebugEnabled() ||
+             (kernel.getKernelInfo().builtinDispatchBuilder != nullptr));
+}
+
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::canAppendToKernelBatch(const Kernel &batchFirstKernel, const Kernel &kernel) {
+    // dispatch flags are programmed once per batch, blocked enqueue takes them from a single kernel
+    if ((kernel.getThreadArbitrationPolicy() != batchFirstKernel.getThreadArbitrationPolicy()) ||
+        (kernel.getAdditionalKernelExecInfo() != batchFirstKernel.getAdditionalKernelExecInfo()) ||
+        (kernel.getExecutionType() != batchFirstKernel.getExecutionType()) ||
+        (kernel.isSingleSubdevicePreferred() != batchFirstKernel.isSingleSubdevicePreferred()) ||
+        (kernel.areStatelessWritesUsed() != batchFirstKernel.areStatelessWritesUsed()) ||
+        (kernel.isVmeKernel() != batchFirstKernel.isVmeKernel()) ||
+        (kernel.requiresSpecialPipelineSelectMode() != batchFirstKernel.requiresSpecialPipelineSelectMode()) ||
+        (kernel.requiresPerDssBackedBuffer() != batchFirstKernel.requiresPerDssBackedBuffer()) ||
+        (kernel.getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired !=
+         batchFirstKernel.getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired)) {
+        return false;
+    }
+    // cache flush after walker is programmed only for the first kernel in the batch
+    return !kernel.requiresCacheFlushCommand(*this);
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueKernels(
+    cl_uint numKernels,
+    const cl_ndrange_kernel_desc_intel *kernelDescs,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    if (numKernels == 0 || kernelDescs == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+
+    auto geometries = std::make_unique<KernelDispatchGeometry[]>(numKernels);
+    for (auto i = 0u; i < numKernels; i++) {
+        auto &kernelDesc = kernelDescs[i];
+        auto &kernel = *castToObjectOrAbort<Kernel>(kernelDesc.kernel);
+
+        if (!isKernelBatchable(kernel)) {
+            return CL_INVALID_KERNEL;
+        }
+
+        auto retVal = validateKernelDispatch(kernel, kernelDesc.workDim, kernelDesc.globalWorkOffset, kernelDesc.globalWorkSize,
+                                             kernelDesc.localWorkSize, geometries[i]);
+        if (retVal != CL_SUCCESS) {
+            if (event) {
+                *event = nullptr;
+            }
+            return retVal;
+        }
+    }
+
+    NullSurface s;
+    Surface *surfaces[] = {&s};
+
+    // Kernel that can't share dispatch flags or post walker cache flush with previous ones starts a new batch.
+    // Each batch waits for the previous one, user's event signals completion of the last.
+    cl_event previousBatchEvent = nullptr;
+    auto batchStart = 0u;
+    while (batchStart < numKernels) {
+        auto &batchFirstKernel = *castToObjectOrAbort<Kernel>(kernelDescs[batchStart].kernel);
+        MultiDispatchInfo multiDispatchInfo;
+        multiDispatchInfo.setKernelBatch(true);
+
+        auto batchEnd = batchStart;
+        do {
+            auto &kernelDesc = kernelDescs[batchEnd];
+            auto &geometry = geometries[batchEnd];
+            DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder(getClDevice());
+            builder.setDispatchGeometry(kernelDesc.workDim, geometry.region, geometry.enqueuedLocalWorkSize, geometry.globalWorkOffset,
+                                        Vec3<size_t>{0, 0, 0}, geometry.localWorkSizeToPass);
+            builder.setKernel(castToObjectOrAbort<Kernel>(kernelDesc.kernel));
+            builder.bake(multiDispatchInfo);
+            batchEnd++;
+        } while ((batchEnd < numKernels) && canAppendToKernelBatch(batchFirstKernel, *castToObjectOrAbort<Kernel>(kernelDescs[batchEnd].kernel)));
+
+        cl_event batchEvent = nullptr;
+        auto outEvent = (batchEnd == numKernels) ? event : &batchEvent;
+        if (previousBatchEvent == nullptr) {
+            enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(surfaces, false, multiDispatchInfo, numEventsInWaitList, eventWaitList, outEvent);
+        } else {
+            enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(surfaces, false, multiDispatchInfo, 1u, &previousBatchEvent, outEvent);
+            castToObjectOrAbort<Event>(previousBatchEvent)->release();
+        }
+        previousBatchEvent = batchEvent;
+        batchStart = batchEnd;
+    }
+
+    return CL_SUCCESS;
+}
 } // namespace NEO
@@ -134,7 +134,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     size_t currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
         dispatchInfo.dispatchInitCommands(*commandStream, timestampPacketDependencies, commandQueue.getDevice().getHardwareInfo(), numSupportedDevices);
-        bool isMainKernel = (dispatchInfo.getKernel() == mainKernel);
+        bool isMainKernel = (dispatchInfo.getKernel() == mainKernel) || multiDispatchInfo.isKernelBatch();
 
         dispatchKernelCommands(commandQueue, dispatchInfo, commandType, *commandStream, isMainKernel,
                                currentDispatchIndex, currentTimestampPacketNodes, preemptionMode, interfaceDescriptorIndex,
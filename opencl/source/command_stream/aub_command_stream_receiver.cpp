@@ -9,7 +9,10 @@
 
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/options.h"
@@ -86,18 +89,34 @@ extern const size_t g_dwordCountMax;
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    dumpedPages.clear();
+    skipUnchangedMemoryWrites = NEO::DebugManager.flags.AUBDumpSkipUnchangedMemory.get();
+    if (NEO::DebugManager.flags.AUBDumpAsyncFileWrites.get() && fileHandle.is_open()) {
+        asyncWriter = std::make_unique<NEO::AsyncFileWriter>(fileHandle, NEO::AsyncFileWriter::defaultChunkSize, NEO::AsyncFileWriter::defaultMaxQueuedChunks);
+    }
 }
 
 void AubFileStream::close() {
+    asyncWriter.reset();
     fileHandle.close();
     fileName.clear();
+    dumpedPages.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (asyncWriter) {
+        asyncWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (asyncWriter) {
+        asyncWriter->flush();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -126,7 +145,47 @@ bool AubFileStream::init(uint32_t stepping, uint32_t device) {
     return true;
 }
 
+template <typename FunctionT>
+static void forEachDumpedPage(uint64_t physAddress, size_t size, FunctionT &&function) {
+    size_t offsetInMemory = 0;
+    while (offsetInMemory < size) {
+        auto address = physAddress + offsetInMemory;
+        auto pageAddress = alignDown(address, MemoryConstants::pageSize);
+        auto offsetInPage = static_cast<uint32_t>(address - pageAddress);
+        auto sizeInPage = std::min(size - offsetInMemory, static_cast<size_t>(MemoryConstants::pageSize - offsetInPage));
+        function(pageAddress, offsetInPage, offsetInMemory, static_cast<uint32_t>(sizeInPage));
+        offsetInMemory += sizeInPage;
+    }
+}
+
+bool AubFileStream::isMemoryDumped(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace) const {
+    bool dumped = (size > 0);
+    forEachDumpedPage(physAddress, size, [&](uint64_t pageAddress, uint32_t offsetInPage, size_t offsetInMemory, uint32_t sizeInPage) {
+        if (!dumped) {
+            return;
+        }
+        auto dumpedPage = dumpedPages.find(pageAddress);
+        dumped = (dumpedPage != dumpedPages.end()) &&
+                 (dumpedPage->second.offsetInPage == offsetInPage) &&
+                 (dumpedPage->second.size == sizeInPage) &&
+                 (dumpedPage->second.addressSpace == addressSpace) &&
+                 (dumpedPage->second.contentHash == NEO::Hash::hash(reinterpret_cast<const char *>(memory) + offsetInMemory, sizeInPage));
+    });
+    return dumped;
+}
+
+void AubFileStream::invalidateDumpedMemory(uint64_t physAddress, size_t size) {
+    forEachDumpedPage(physAddress, size, [&](uint64_t pageAddress, uint32_t offsetInPage, size_t offsetInMemory, uint32_t sizeInPage) {
+        dumpedPages.erase(pageAddress);
+    });
+}
+
 void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) {
+    if (skipUnchangedMemoryWrites && isMemoryDumped(physAddress, memory, size, addressSpace)) {
+        // Same bytes over the same physical pages are already in this file.
+        return;
+    }
+
     writeMemoryWriteHeader(physAddress, size, addressSpace, hint);
 
     // Copy the contents from source to destination.
@@ -138,9 +197,21 @@ void AubFileStream::writeMemory(uint64_t physAddress, const void *memory, size_t
         uint32_t zero = 0;
         write(reinterpret_cast<char *>(&zero), sizeof(uint32_t) - sizeRemainder);
     }
+
+    if (skipUnchangedMemoryWrites) {
+        forEachDumpedPage(physAddress, size, [&](uint64_t pageAddress, uint32_t offsetInPage, size_t offsetInMemory, uint32_t sizeInPage) {
+            auto contentHash = NEO::Hash::hash(reinterpret_cast<const char *>(memory) + offsetInMemory, sizeInPage);
+            dumpedPages[pageAddress] = {contentHash, offsetInPage, sizeInPage, addressSpace};
+        });
+    }
 }
 
 void AubFileStream::writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) {
+    if (skipUnchangedMemoryWrites) {
+        // Raw writes following this header (e.g. page table entries) are not tracked.
+        invalidateDumpedMemory(physAddress, size);
+    }
+
     CmdServicesMemTraceMemoryWrite header = {};
     auto alignedBlockSize = (size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
     auto dwordCount = (sizeMemoryWriteHeader + alignedBlockSize) / sizeof(uint32_t);
@@ -41,6 +41,7 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     bool flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
 
     void processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) override;
+    MOCKABLE_VIRTUAL void invalidateDumpedMemory(GraphicsAllocation &gfxAllocation);
 
     void makeResidentExternal(AllocationView &allocationView);
     void makeNonResidentExternal(uint64_t gpuAddress);
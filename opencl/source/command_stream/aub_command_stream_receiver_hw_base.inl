@@ -15,6 +15,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -709,6 +710,23 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::expectMemory(const void *gfxAddress,
     return true;
 }
 
+template <typename GfxFamily>
+void AUBCommandStreamReceiverHw<GfxFamily>::invalidateDumpedMemory(GraphicsAllocation &gfxAllocation) {
+    // Memory the GPU may write during this submission can't be compared against what was last dumped,
+    // so identical host uploads to it later have to be written again.
+    if (aubManager || !DebugManager.flags.AUBDumpSkipUnchangedMemory.get() ||
+        AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType()) ||
+        gfxAllocation.getUnderlyingBufferSize() == 0) {
+        return;
+    }
+
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        getAubStream()->invalidateDumpedMemory(physAddress, size);
+    };
+    auto gpuAddress = GmmHelper::decanonize(gfxAllocation.getGpuAddress());
+    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), gfxAllocation.getUnderlyingBufferSize(), 0, this->getPPGTTAdditionalBits(&gfxAllocation), walker, this->getMemoryBank(&gfxAllocation));
+}
+
 template <typename GfxFamily>
 void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) {
     if (subCaptureManager->isSubCaptureMode()) {
@@ -721,6 +739,8 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
         if (!writeMemory(externalAllocation)) {
             DEBUG_BREAK_IF(externalAllocation.second != 0);
         }
+        GraphicsAllocation externalGfxAllocation(this->rootDeviceIndex, GraphicsAllocation::AllocationType::UNKNOWN, reinterpret_cast<void *>(externalAllocation.first), externalAllocation.first, 0llu, externalAllocation.second, MemoryPool::MemoryNull, 0u);
+        invalidateDumpedMemory(externalGfxAllocation);
     }
 
     for (auto &gfxAllocation : allocationsForResidency) {
@@ -731,6 +751,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) ||
                              !this->isAubWritable(*gfxAllocation)));
         }
+        invalidateDumpedMemory(*gfxAllocation);
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
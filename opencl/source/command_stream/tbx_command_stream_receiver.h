@@ -12,6 +12,7 @@
 namespace NEO {
 class CommandStreamReceiver;
 class TbxSockets;
+struct TbxMemoryRange;
 class ExecutionEnvironment;
 
 class TbxStream : public AubMemDump::AubStream {
@@ -35,6 +36,7 @@ class TbxStream : public AubMemDump::AubStream {
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
     void readMemory(uint64_t physAddress, void *memory, size_t size);
+    void readMemoryRanges(const TbxMemoryRange *ranges, size_t count);
 };
 
 struct TbxCommandStreamReceiver {
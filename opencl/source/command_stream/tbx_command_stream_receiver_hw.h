@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/address_mapper.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 
@@ -16,6 +17,7 @@
 #include "command_stream_receiver_simulated_hw.h"
 
 #include <set>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -56,6 +58,9 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
     AubSubCaptureStatus checkAndActivateAubSubCapture(const MultiDispatchInfo &dispatchInfo) override;
 
+    // neighbouring pages are merged into a single TBX read or write up to this size, requests carry 32-bit sizes
+    static constexpr size_t maxCoalescedMemorySize = 64 * MemoryConstants::megaByte;
+
     // Family specific version
     MOCKABLE_VIRTUAL void submitBatchBuffer(uint64_t batchBufferGpuAddress, const void *batchBuffer, size_t batchBufferSize, uint32_t memoryBank, uint64_t entryBits, bool overrideRingHead);
     void pollForCompletion() override;
@@ -97,5 +102,19 @@ class TbxCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     }
 
     bool dumpTbxNonWritable = false;
+
+  protected:
+    // TbxSkipUnchangedMemory: content simulator memory is known to hold, per physical page,
+    // together with entry bits its page table entry was written with.
+    // Stale pages were submitted as GPU writable and weren't downloaded since.
+    struct KnownMemory {
+        uint64_t contentHash;
+        size_t size;
+        uint64_t entryBits;
+        bool stale;
+    };
+    bool updateKnownMemory(uint64_t physAddress, const void *memory, size_t size, uint64_t entryBits);
+    void forgetKnownMemory(GraphicsAllocation &gfxAllocation);
+    std::unordered_map<uint64_t, KnownMemory> knownMemory;
 };
 } // namespace NEO
@@ -13,10 +13,12 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/populate_factory.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -24,6 +26,7 @@
 #include "shared/source/memory_manager/memory_banks.h"
 #include "shared/source/memory_manager/physical_address_allocator.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/tbx/tbx_sockets.h"
 
 #include "opencl/source/command_stream/aub_command_stream_receiver.h"
 #include "opencl/source/command_stream/command_stream_receiver_with_aub_dump.h"
@@ -32,9 +35,13 @@
 #include "opencl/source/os_interface/ocl_reg_path.h"
 
 #include <cstring>
+#include <vector>
 
 namespace NEO {
 
+template <typename GfxFamily>
+constexpr size_t TbxCommandStreamReceiverHw<GfxFamily>::maxCoalescedMemorySize;
+
 template <typename GfxFamily>
 TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvironment &executionEnvironment,
                                                                   uint32_t rootDeviceIndex,
@@ -407,13 +414,81 @@ template <typename GfxFamily>
 void TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) {
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
+    auto skipUnchangedMemory = DebugManager.flags.TbxSkipUnchangedMemory.get();
+
+    // Pages contiguous in both physical and CPU memory are sent as a single write, up to maxCoalescedMemorySize
+    uint64_t pendingPhysAddress = 0;
+    void *pendingMemory = nullptr;
+    size_t pendingSize = 0;
+    int pendingAddressSpace = 0;
+    auto writePendingMemory = [&]() {
+        if (pendingSize > 0) {
+            AUB::addMemoryWrite(tbxStream, pendingPhysAddress, pendingMemory, pendingSize, pendingAddressSpace);
+            pendingSize = 0;
+        }
+    };
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
-        AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
-                                              aubHelperHw);
+        auto memory = ptrOffset(cpuAddress, offset);
+        if (skipUnchangedMemory && !updateKnownMemory(physAddress, memory, size, entryBits)) {
+            return;
+        }
+
+        auto vmAddr = (static_cast<uintptr_t>(gpuAddress) + offset) & ~(MemoryConstants::pageSize - 1);
+        auto pAddr = physAddress & ~(MemoryConstants::pageSize - 1);
+        AUB::reserveAddressPPGTT(tbxStream, vmAddr, MemoryConstants::pageSize, pAddr, entryBits, aubHelperHw);
+
+        int addressSpace = AubHelper::getMemTrace(entryBits);
+        if (pendingSize > 0 &&
+            pendingSize + size <= maxCoalescedMemorySize &&
+            pendingPhysAddress + pendingSize == physAddress &&
+            ptrOffset(pendingMemory, pendingSize) == memory &&
+            pendingAddressSpace == addressSpace) {
+            pendingSize += size;
+            return;
+        }
+
+        writePendingMemory();
+        pendingPhysAddress = physAddress;
+        pendingMemory = memory;
+        pendingSize = size;
+        pendingAddressSpace = addressSpace;
     };
 
     ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
+    writePendingMemory();
+}
+
+template <typename GfxFamily>
+bool TbxCommandStreamReceiverHw<GfxFamily>::updateKnownMemory(uint64_t physAddress, const void *memory, size_t size, uint64_t entryBits) {
+    auto contentHash = Hash::hash(reinterpret_cast<const char *>(memory), size);
+    auto known = knownMemory.find(physAddress);
+    if (known != knownMemory.end() && !known->second.stale &&
+        known->second.contentHash == contentHash && known->second.size == size && known->second.entryBits == entryBits) {
+        return false;
+    }
+    knownMemory[physAddress] = {contentHash, size, entryBits, false};
+    return true;
+}
+
+template <typename GfxFamily>
+void TbxCommandStreamReceiverHw<GfxFamily>::forgetKnownMemory(GraphicsAllocation &gfxAllocation) {
+    // The GPU may write this memory during the submission, only a download tells what simulator memory holds afterwards.
+    // Page table entries stay valid, so pages remain tracked for downloads to refresh.
+    if (aubManager || knownMemory.empty() ||
+        AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType()) ||
+        gfxAllocation.getUnderlyingBufferSize() == 0) {
+        return;
+    }
+
+    PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        auto known = knownMemory.find(physAddress);
+        if (known != knownMemory.end()) {
+            known->second.stale = true;
+        }
+    };
+    auto gpuAddress = GmmHelper::decanonize(gfxAllocation.getGpuAddress());
+    ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), gfxAllocation.getUnderlyingBufferSize(), 0, PageTableEntry::nonValidBits, walker, this->getMemoryBank(&gfxAllocation));
 }
 
 template <typename GfxFamily>
@@ -499,6 +574,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
             DEBUG_BREAK_IF(!((gfxAllocation->getUnderlyingBufferSize() == 0) ||
                              !this->isTbxWritable(*gfxAllocation)));
         }
+        forgetKnownMemory(*gfxAllocation);
         gfxAllocation->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
     }
 
@@ -518,11 +594,39 @@ void TbxCommandStreamReceiverHw<GfxFamily>::downloadAllocation(GraphicsAllocatio
     auto length = gfxAllocation.getUnderlyingBufferSize();
 
     if (length) {
+        auto skipUnchangedMemory = DebugManager.flags.TbxSkipUnchangedMemory.get();
+        std::vector<TbxMemoryRange> ranges;
+        std::vector<TbxMemoryRange> pages;
+
         PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
             DEBUG_BREAK_IF(offset > length);
-            tbxStream.readMemory(physAddress, ptrOffset(cpuAddress, offset), size);
+            auto memory = ptrOffset(cpuAddress, offset);
+            if (skipUnchangedMemory) {
+                pages.push_back({physAddress, memory, size});
+            }
+            if (!ranges.empty()) {
+                auto &lastRange = ranges.back();
+                if (lastRange.size + size <= maxCoalescedMemorySize &&
+                    lastRange.addr + lastRange.size == physAddress && ptrOffset(lastRange.memory, lastRange.size) == memory) {
+                    lastRange.size += size;
+                    return;
+                }
+            }
+            ranges.push_back({physAddress, memory, size});
         };
         ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), length, 0, 0, walker, this->getMemoryBank(&gfxAllocation));
+
+        tbxStream.readMemoryRanges(ranges.data(), ranges.size());
+
+        // Only pages written before are tracked, the rest still needs its page table entries written
+        for (auto &page : pages) {
+            auto known = knownMemory.find(page.addr);
+            if (known != knownMemory.end()) {
+                known->second.contentHash = Hash::hash(reinterpret_cast<const char *>(page.memory), page.size);
+                known->second.size = page.size;
+                known->second.stale = false;
+            }
+        }
     }
 }
 
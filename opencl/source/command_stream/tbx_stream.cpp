@@ -73,4 +73,8 @@ void TbxStream::readMemory(uint64_t physAddress, void *memory, size_t size) {
     socket->readMemory(physAddress, memory, size);
 }
 
+void TbxStream::readMemoryRanges(const TbxMemoryRange *ranges, size_t count) {
+    socket->readMemoryRanges(ranges, count);
+}
+
 } // namespace NEO
@@ -15,6 +15,8 @@
 #include "opencl/source/context/driver_diagnostics.h"
 #include "opencl/source/helpers/base_object.h"
 #include "opencl/source/helpers/destructor_callbacks.h"
+#include "opencl/source/mem_obj/image_surface_state_cache.h"
+#include "opencl/source/program/program_artifacts_registry.h"
 
 #include <list>
 #include <map>
@@ -160,6 +162,12 @@ class Context : public BaseObject<_cl_context> {
     const ClDeviceVector &getDevices() const {
         return devices;
     }
+    ImageSurfaceStateCache &getImageSurfaceStateCache() {
+        return imageSurfaceStateCache;
+    }
+    ProgramArtifactsRegistry &getProgramArtifactsRegistry() {
+        return programArtifactsRegistry;
+    }
 
   protected:
     struct BuiltInKernel {
@@ -196,6 +204,8 @@ class Context : public BaseObject<_cl_context> {
     StackVec<CommandQueue *, 1> specialQueues;
     DeviceQueue *defaultDeviceQueue = nullptr;
     DriverDiagnostics *driverDiagnostics = nullptr;
+    ImageSurfaceStateCache imageSurfaceStateCache;
+    ProgramArtifactsRegistry programArtifactsRegistry;
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
@@ -250,7 +250,7 @@ uint64_t DeviceQueueHw<GfxFamily>::getBlockKernelStartPointer(const Device &devi
     auto blockAllocation = blockInfo->getGraphicsAllocation();
     DEBUG_BREAK_IF(!blockAllocation);
 
-    auto blockKernelStartPointer = blockAllocation ? blockAllocation->getGpuAddressToPatch() : 0llu;
+    auto blockKernelStartPointer = blockAllocation ? blockAllocation->getGpuAddressToPatch() + blockInfo->getIsaOffsetInParentAllocation() : 0llu;
 
     auto &hardwareInfo = device.getHardwareInfo();
     auto &hwHelper = HwHelper::get(hardwareInfo.platform.eRenderCoreFamily);
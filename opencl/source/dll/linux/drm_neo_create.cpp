@@ -53,6 +53,8 @@ Drm *Drm::create(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &
         return nullptr;
     }
 
+    drmObject->loadCapsSnapshot();
+
     const DeviceDescriptor *device = nullptr;
     const char *devName = "";
     GTTYPE eGtType = GTTYPE_UNDEFINED;
@@ -80,7 +82,7 @@ Drm *Drm::create(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &
 
     // Detect device parameters
     int hasExecSoftPin = 0;
-    ret = drmObject->getExecSoftPin(hasExecSoftPin);
+    ret = drmObject->getExecSoftPinCached(hasExecSoftPin);
     if (ret != 0) {
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "FATAL: Cannot query Soft Pin parameter!\n");
         return nullptr;
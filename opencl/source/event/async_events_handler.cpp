@@ -10,8 +10,10 @@
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
@@ -36,14 +38,31 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+namespace {
+bool isEventPending(Event *event) {
+    return event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+}
+
+bool hasHigherTaskCount(Event *lhs, Event *rhs) {
+    return lhs->peekTaskCount() > rhs->peekTaskCount();
+}
+} // namespace
+
 Event *AsyncEventsHandler::processList() {
     uint32_t lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
+    processSubmittedEvents();
+
     for (auto event : list) {
         event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+        if (isEventPending(event)) {
+            if (event->peekExecutionStatus() == CL_SUBMITTED && event->getCommandQueue() != nullptr &&
+                event->peekTaskCount() != CompletionStamp::notReady && !event->isExternallySynchronized()) {
+                scheduleSubmittedEvent(event);
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -55,9 +74,49 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+
+    for (auto &submitted : submittedEvents) {
+        auto event = submitted.second.front();
+        if (event->peekTaskCount() < lowestTaskCount) {
+            sleepCandidate = event;
+            lowestTaskCount = event->peekTaskCount();
+        }
+    }
     return sleepCandidate;
 }
 
+void AsyncEventsHandler::processSubmittedEvents() {
+    for (auto it = submittedEvents.begin(); it != submittedEvents.end();) {
+        auto &heap = it->second;
+        while (!heap.empty()) {
+            auto event = heap.front();
+            event->updateExecutionStatus();
+            if (event->peekExecutionStatus() == CL_SUBMITTED && isEventPending(event)) {
+                // task counts complete in order on a CSR, so nothing behind the top can be done yet
+                break;
+            }
+            std::pop_heap(heap.begin(), heap.end(), hasHigherTaskCount);
+            heap.pop_back();
+            if (isEventPending(event)) {
+                list.push_back(event);
+            } else {
+                event->decRefInternal();
+            }
+        }
+        if (heap.empty()) {
+            it = submittedEvents.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void AsyncEventsHandler::scheduleSubmittedEvent(Event *event) {
+    auto &heap = submittedEvents[&event->getCommandQueue()->getGpgpuCommandStreamReceiver()];
+    heap.push_back(event);
+    std::push_heap(heap.begin(), heap.end(), hasHigherTaskCount);
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -71,7 +130,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->list.empty() && self->submittedEvents.empty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -114,6 +173,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &submitted : submittedEvents) {
+        for (auto event : submitted.second) {
+            event->decRefInternal();
+        }
+    }
+    submittedEvents.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
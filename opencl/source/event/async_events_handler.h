@@ -8,11 +8,13 @@
 #pragma once
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -25,6 +27,8 @@ class AsyncEventsHandler {
 
   protected:
     Event *processList();
+    void processSubmittedEvents();
+    void scheduleSubmittedEvent(Event *event);
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,6 +36,8 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    // submitted events waiting only for GPU completion, kept as per-CSR min-heaps ordered by task count
+    std::map<CommandStreamReceiver *, std::vector<Event *>> submittedEvents;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -26,13 +26,13 @@ int HwInfoConfigHw<IGFX_GEMINILAKE>::configureHardwareCustom(HardwareInfo *hwInf
     gtSystemInfo->VEBoxInfo.IsValid = true;
 
     int enabled = 0;
-    int retVal = drm->getEnabledPooledEu(enabled);
+    int retVal = drm->getEnabledPooledEuCached(enabled);
     if (retVal == 0) {
         featureTable->ftrPooledEuEnabled = (enabled != 0);
     }
     if (enabled) {
         int num = 0;
-        retVal = drm->getMinEuInPool(num);
+        retVal = drm->getMinEuInPoolCached(num);
         if (retVal == 0 && ((num == 3) || (num == 6) || (num == 9))) {
             gtSystemInfo->EuCountPerPoolMin = static_cast<uint32_t>(num);
         }
@@ -205,11 +205,20 @@ struct MultiDispatchInfo {
         return memObjsForAuxTranslation;
     }
 
+    void setKernelBatch(bool kernelBatch) {
+        this->kernelBatch = kernelBatch;
+    }
+
+    bool isKernelBatch() const {
+        return kernelBatch;
+    }
+
   protected:
     BuiltinOpParams builtinOpParams = {};
     StackVec<DispatchInfo, 9> dispatchInfos;
     StackVec<MemObj *, 2> redescribedSurfaces;
     const MemObjsForAuxTranslation *memObjsForAuxTranslation = nullptr;
     Kernel *mainKernel = nullptr;
+    bool kernelBatch = false;
 };
 } // namespace NEO
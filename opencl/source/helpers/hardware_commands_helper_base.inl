@@ -162,9 +162,31 @@ size_t HardwareCommandsHelper<GfxFamily>::sendInterfaceDescriptorData(
     const HardwareInfo &hardwareInfo) {
     using SAMPLER_STATE = typename GfxFamily::SAMPLER_STATE;
 
+    static_assert(sizeof(INTERFACE_DESCRIPTOR_DATA) <= InterfaceDescriptorTemplate::maxSize, "interface descriptor template storage too small");
+
     // Allocate some memory for the interface descriptor
     auto pInterfaceDescriptor = getInterfaceDescriptor(indirectHeap, offsetInterfaceDescriptor, inlineInterfaceDescriptor);
+
+    auto &interfaceDescriptorTemplate = kernel.getInterfaceDescriptorTemplate();
+    InterfaceDescriptorTemplate::Key templateKey;
+    templateKey.hardwareInfo = &hardwareInfo;
+    templateKey.kernelStartOffset = kernelStartOffset;
+    templateKey.sizeCrossThreadData = sizeCrossThreadData;
+    templateKey.sizePerThreadData = sizePerThreadData;
+    templateKey.threadsPerThreadGroup = threadsPerThreadGroup;
+    templateKey.numSamplers = numSamplers;
+    templateKey.bindingTablePrefetchSize = bindingTablePrefetchSize;
+    templateKey.slmTotalSize = kernel.slmTotalSize;
+    templateKey.preemptionMode = preemptionMode;
+
+    bool useInterfaceDescriptorTemplate = DebugManager.flags.EnableInterfaceDescriptorTemplates.get() != 0;
     auto interfaceDescriptor = GfxFamily::cmdInitInterfaceDescriptorData;
+    if (useInterfaceDescriptorTemplate && interfaceDescriptorTemplate.copyTo(templateKey, &interfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA))) {
+        interfaceDescriptor.setBindingTablePointer(static_cast<uint32_t>(bindingTablePointer));
+        interfaceDescriptor.setSamplerStatePointer(static_cast<uint32_t>(offsetSamplerState));
+        *pInterfaceDescriptor = interfaceDescriptor;
+        return static_cast<size_t>(offsetInterfaceDescriptor);
+    }
 
     // Program the kernel start pointer
     interfaceDescriptor.setKernelStartPointerHigh(kernelStartOffset >> 32);
@@ -195,6 +217,10 @@ size_t HardwareCommandsHelper<GfxFamily>::sendInterfaceDescriptorData(
     PreemptionHelper::programInterfaceDescriptorDataPreemption<GfxFamily>(&interfaceDescriptor, preemptionMode);
     EncodeDispatchKernel<GfxFamily>::adjustInterfaceDescriptorData(interfaceDescriptor, hardwareInfo);
 
+    if (useInterfaceDescriptorTemplate) {
+        interfaceDescriptorTemplate.update(templateKey, &interfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA));
+    }
+
     *pInterfaceDescriptor = interfaceDescriptor;
     return (size_t)offsetInterfaceDescriptor;
 }
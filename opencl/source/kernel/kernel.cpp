@@ -20,6 +20,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -481,7 +482,7 @@ cl_int Kernel::getInfo(cl_kernel_info paramName, size_t paramValueSize,
         srcSize = getKernelHeapSize();
         break;
     case CL_KERNEL_BINARY_GPU_ADDRESS_INTEL:
-        nonCannonizedGpuAddress = GmmHelper::decanonize(kernelInfo.kernelAllocation->getGpuAddress());
+        nonCannonizedGpuAddress = GmmHelper::decanonize(kernelInfo.kernelAllocation->getGpuAddress() + kernelInfo.getIsaOffsetInParentAllocation());
         pSrc = &nonCannonizedGpuAddress;
         srcSize = sizeof(nonCannonizedGpuAddress);
         break;
@@ -756,10 +757,14 @@ void Kernel::substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize)
 
     auto currentAllocationSize = pKernelInfo->kernelAllocation->getUnderlyingBufferSize();
     bool status = false;
-    if (currentAllocationSize >= newKernelHeapSize) {
+    if (pKernelInfo->isaHeapAllocator == nullptr && currentAllocationSize >= newKernelHeapSize) {
         status = memoryManager->copyMemoryToAllocation(pKernelInfo->kernelAllocation, 0, newKernelHeap, newKernelHeapSize);
     } else {
-        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(pKernelInfo->kernelAllocation);
+        if (pKernelInfo->isaHeapAllocator) {
+            pKernelInfo->isaHeapAllocator->free(pKernelInfo->kernelAllocation, pKernelInfo->kernelAllocationOffset);
+        } else {
+            memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(pKernelInfo->kernelAllocation);
+        }
         pKernelInfo->kernelAllocation = nullptr;
         status = pKernelInfo->createKernelAllocation(getDevice().getDevice(), isBuiltIn);
     }
@@ -2453,7 +2458,7 @@ uint64_t Kernel::getKernelStartOffset(
     uint64_t kernelStartOffset = 0;
 
     if (kernelInfo.getGraphicsAllocation()) {
-        kernelStartOffset = kernelInfo.getGraphicsAllocation()->getGpuAddressToPatch();
+        kernelStartOffset = kernelInfo.getGraphicsAllocation()->getGpuAddressToPatch() + kernelInfo.getIsaOffsetInParentAllocation();
         if (localIdsGenerationByRuntime == false && kernelUsesLocalIds == true) {
             kernelStartOffset += kernelInfo.patchInfo.threadPayload->OffsetToSkipPerThreadDataLoad;
         }
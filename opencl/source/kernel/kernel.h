@@ -7,11 +7,13 @@
 
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
+#include "shared/source/command_stream/preemption_mode.h"
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/address_patch.h"
 #include "shared/source/helpers/preamble.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -27,6 +29,7 @@
 
 #include "csr_properties_flags.h"
 
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -43,6 +46,56 @@ struct OpenCLObjectMapper<_cl_kernel> {
     typedef class Kernel DerivedType;
 };
 
+struct InterfaceDescriptorTemplate {
+    struct Key {
+        const HardwareInfo *hardwareInfo = nullptr;
+        uint64_t kernelStartOffset = 0;
+        size_t sizeCrossThreadData = 0;
+        size_t sizePerThreadData = 0;
+        uint32_t threadsPerThreadGroup = 0;
+        uint32_t numSamplers = 0;
+        uint32_t bindingTablePrefetchSize = 0;
+        uint32_t slmTotalSize = 0;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+
+        bool operator==(const Key &other) const {
+            return hardwareInfo == other.hardwareInfo &&
+                   kernelStartOffset == other.kernelStartOffset &&
+                   sizeCrossThreadData == other.sizeCrossThreadData &&
+                   sizePerThreadData == other.sizePerThreadData &&
+                   threadsPerThreadGroup == other.threadsPerThreadGroup &&
+                   numSamplers == other.numSamplers &&
+                   bindingTablePrefetchSize == other.bindingTablePrefetchSize &&
+                   slmTotalSize == other.slmTotalSize &&
+                   preemptionMode == other.preemptionMode;
+        }
+    };
+
+    static constexpr size_t maxSize = 64;
+
+    // Same kernel may be enqueued from several queues at once, so descriptor is copied in and out under lock
+    bool copyTo(const Key &expectedKey, void *dst, size_t size) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!valid || !(key == expectedKey)) {
+            return false;
+        }
+        memcpy_s(dst, size, data, size);
+        return true;
+    }
+
+    void update(const Key &newKey, const void *src, size_t size) {
+        std::lock_guard<std::mutex> lock(mtx);
+        memcpy_s(data, maxSize, src, size);
+        key = newKey;
+        valid = true;
+    }
+
+    std::mutex mtx;
+    Key key;
+    bool valid = false;
+    alignas(8) uint8_t data[maxSize] = {};
+};
+
 class Kernel : public BaseObject<_cl_kernel> {
   public:
     static const cl_ulong objectMagic = 0x3284ADC8EA0AFE25LL;
@@ -393,7 +446,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     void setUnifiedMemoryExecInfo(GraphicsAllocation *argValue);
     void clearUnifiedMemoryExecInfo();
 
-    bool areStatelessWritesUsed() { return containsStatelessWrites; }
+    bool areStatelessWritesUsed() const { return containsStatelessWrites; }
     int setKernelThreadArbitrationPolicy(uint32_t propertyValue);
     cl_int setKernelExecutionType(cl_execution_info_kernel_type_intel executionType);
     void setThreadArbitrationPolicy(uint32_t policy) {
@@ -419,6 +472,9 @@ class Kernel : public BaseObject<_cl_kernel> {
     const ClDeviceVector &getDevices() const {
         return program->getDevices();
     }
+    InterfaceDescriptorTemplate &getInterfaceDescriptorTemplate() const {
+        return interfaceDescriptorTemplate;
+    }
 
   protected:
     struct ObjectCounts {
@@ -553,6 +609,7 @@ class Kernel : public BaseObject<_cl_kernel> {
     bool isUnifiedMemorySyncRequired = true;
     bool debugEnabled = false;
     uint32_t additionalKernelExecInfo = AdditionalKernelExecInfo::NotSet;
+    mutable InterfaceDescriptorTemplate interfaceDescriptorTemplate;
 
     struct KernelDeviceInfo : public NonCopyableClass {
         std::unique_ptr<char[]> pSshLocal;
@@ -16,6 +16,7 @@
 
 namespace NEO {
 class Image;
+struct ImageSurfaceStateKey;
 struct KernelInfo;
 struct SurfaceFormatInfo;
 
@@ -301,6 +302,7 @@ class ImageHw : public Image {
     }
 
     void setImageArg(void *memory, bool setAsMediaBlockImage, uint32_t mipLevel, uint32_t rootDeviceIndex) override;
+    bool getSurfaceStateTemplateKey(ImageSurfaceStateKey &key, Gmm *gmm, bool setAsMediaBlockImage, uint32_t mipLevel, uint32_t rootDeviceIndex);
     void setAuxParamsForMultisamples(RENDER_SURFACE_STATE *surfaceState);
     MOCKABLE_VIRTUAL void setAuxParamsForMCSCCS(RENDER_SURFACE_STATE *surfaceState, Gmm *gmm);
     void setMediaImageArg(void *memory, uint32_t rootDeviceIndex) override;
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/populate_factory.h"
 
+#include "opencl/source/context/context.h"
 #include "opencl/source/helpers/surface_formats.h"
 #include "opencl/source/mem_obj/image.h"
 
@@ -38,6 +39,14 @@ void ImageHw<GfxFamily>::setImageArg(void *memory, bool setAsMediaBlockImage, ui
     auto gmm = graphicsAllocation->getDefaultGmm();
     auto gmmHelper = executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->getGmmHelper();
 
+    ImageSurfaceStateKey surfaceStateKey;
+    bool useSurfaceStateTemplate = getSurfaceStateTemplateKey(surfaceStateKey, gmm, setAsMediaBlockImage, mipLevel, rootDeviceIndex);
+    if (useSurfaceStateTemplate &&
+        context->getImageSurfaceStateCache().find(surfaceStateKey, surfaceState, sizeof(RENDER_SURFACE_STATE))) {
+        surfaceState->setSurfaceBaseAddress(graphicsAllocation->getGpuAddress() + surfaceOffsets.offset);
+        return;
+    }
+
     auto imageDescriptor = Image::convertDescriptor(getImageDesc());
     ImageInfo imgInfo;
     imgInfo.imgDesc = imageDescriptor;
@@ -93,6 +102,53 @@ void ImageHw<GfxFamily>::setImageArg(void *memory, bool setAsMediaBlockImage, ui
     appendSurfaceStateDepthParams(surfaceState, gmm);
     appendSurfaceStateParams(surfaceState, rootDeviceIndex);
     appendSurfaceStateExt(surfaceState);
+
+    if (useSurfaceStateTemplate) {
+        context->getImageSurfaceStateCache().store(surfaceStateKey, surfaceState, sizeof(RENDER_SURFACE_STATE));
+    }
+}
+
+template <typename GfxFamily>
+bool ImageHw<GfxFamily>::getSurfaceStateTemplateKey(ImageSurfaceStateKey &key, Gmm *gmm, bool setAsMediaBlockImage, uint32_t mipLevel, uint32_t rootDeviceIndex) {
+    static_assert(sizeof(RENDER_SURFACE_STATE) <= ImageSurfaceStateCache::maxSurfaceStateSize, "");
+
+    if (DebugManager.flags.EnableImageSurfaceStateTemplates.get() == 0 || context == nullptr) {
+        return false;
+    }
+    // aux surface addresses depend on the allocation, so only the uncompressed single-sampled case is templated
+    if (imageDesc.num_samples > 1 || mcsSurfaceInfo.multisampleCount > 1 || (gmm && gmm->isRenderCompressed)) {
+        return false;
+    }
+
+    key.rootDeviceIndex = rootDeviceIndex;
+    key.mipLevel = mipLevel;
+    key.imageType = imageDesc.image_type;
+    key.imageWidth = imageDesc.image_width;
+    key.imageHeight = imageDesc.image_height;
+    key.imageDepth = imageDesc.image_depth;
+    key.imageArraySize = imageDesc.image_array_size;
+    key.imageRowPitch = imageDesc.image_row_pitch;
+    key.imageSlicePitch = imageDesc.image_slice_pitch;
+    key.channelOrder = surfaceFormatInfo.OCLImageFormat.image_channel_order;
+    key.channelDataType = surfaceFormatInfo.OCLImageFormat.image_channel_data_type;
+    key.genxSurfaceFormat = surfaceFormatInfo.surfaceFormat.GenxSurfaceFormat;
+    key.qPitch = qPitch;
+    key.cubeFaceIndex = cubeFaceIndex;
+    key.baseMipLevel = baseMipLevel;
+    key.mipCount = mipCount;
+    key.xOffset = surfaceOffsets.xOffset;
+    key.yOffset = surfaceOffsets.yOffset;
+    key.yOffsetForUVPlane = surfaceOffsets.yOffsetForUVplane;
+    key.isMediaBlockImage = setAsMediaBlockImage;
+    if (gmm) {
+        key.hasGmm = true;
+        key.tileMode = gmm->gmmResourceInfo->getTileModeSurfaceState();
+        key.hAlign = gmm->gmmResourceInfo->getHAlignSurfaceState();
+        key.vAlign = gmm->gmmResourceInfo->getVAlignSurfaceState();
+        key.mipTailStartLod = gmm->gmmResourceInfo->getMipTailStartLodSurfaceState();
+        key.isDepthResource = gmm->gmmResourceInfo->getResourceFlags()->Gpu.Depth;
+    }
+    return true;
 }
 
 template <typename GfxFamily>
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/mem_obj/image_surface_state_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cstring>
+
+namespace NEO {
+
+bool ImageSurfaceStateKey::operator==(const ImageSurfaceStateKey &rhs) const {
+    return rootDeviceIndex == rhs.rootDeviceIndex &&
+           mipLevel == rhs.mipLevel &&
+           imageType == rhs.imageType &&
+           imageWidth == rhs.imageWidth &&
+           imageHeight == rhs.imageHeight &&
+           imageDepth == rhs.imageDepth &&
+           imageArraySize == rhs.imageArraySize &&
+           imageRowPitch == rhs.imageRowPitch &&
+           imageSlicePitch == rhs.imageSlicePitch &&
+           channelOrder == rhs.channelOrder &&
+           channelDataType == rhs.channelDataType &&
+           genxSurfaceFormat == rhs.genxSurfaceFormat &&
+           qPitch == rhs.qPitch &&
+           cubeFaceIndex == rhs.cubeFaceIndex &&
+           baseMipLevel == rhs.baseMipLevel &&
+           mipCount == rhs.mipCount &&
+           xOffset == rhs.xOffset &&
+           yOffset == rhs.yOffset &&
+           yOffsetForUVPlane == rhs.yOffsetForUVPlane &&
+           tileMode == rhs.tileMode &&
+           hAlign == rhs.hAlign &&
+           vAlign == rhs.vAlign &&
+           mipTailStartLod == rhs.mipTailStartLod &&
+           hasGmm == rhs.hasGmm &&
+           isDepthResource == rhs.isDepthResource &&
+           isMediaBlockImage == rhs.isMediaBlockImage;
+}
+
+bool ImageSurfaceStateCache::find(const ImageSurfaceStateKey &key, void *surfaceState, size_t surfaceStateSize) {
+    DEBUG_BREAK_IF(surfaceStateSize > maxSurfaceStateSize);
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        if (entry.key == key) {
+            memcpy(surfaceState, entry.surfaceState, surfaceStateSize);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ImageSurfaceStateCache::store(const ImageSurfaceStateKey &key, const void *surfaceState, size_t surfaceStateSize) {
+    UNRECOVERABLE_IF(surfaceStateSize > maxSurfaceStateSize);
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        if (entry.key == key) {
+            memcpy(entry.surfaceState, surfaceState, surfaceStateSize);
+            return;
+        }
+    }
+
+    Entry *entry = nullptr;
+    if (entries.size() < maxEntries) {
+        entries.emplace_back();
+        entry = &entries.back();
+    } else {
+        entry = &entries[nextEntryToReplace];
+        nextEntryToReplace = (nextEntryToReplace + 1) % maxEntries;
+    }
+    entry->key = key;
+    memcpy(entry->surfaceState, surfaceState, surfaceStateSize);
+}
+
+size_t ImageSurfaceStateCache::getNumEntries() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+} // namespace NEO
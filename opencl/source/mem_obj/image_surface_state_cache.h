@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Describes everything that RENDER_SURFACE_STATE of an image depends on except its base address.
+// Images sharing a key differ only in SurfaceBaseAddress, so a previously encoded state can be reused.
+struct ImageSurfaceStateKey {
+    uint32_t rootDeviceIndex = 0;
+    uint32_t mipLevel = 0;
+    uint32_t imageType = 0;
+    uint64_t imageWidth = 0;
+    uint64_t imageHeight = 0;
+    uint64_t imageDepth = 0;
+    uint64_t imageArraySize = 0;
+    uint64_t imageRowPitch = 0;
+    uint64_t imageSlicePitch = 0;
+    uint32_t channelOrder = 0;
+    uint32_t channelDataType = 0;
+    uint32_t genxSurfaceFormat = 0;
+    uint32_t qPitch = 0;
+    uint32_t cubeFaceIndex = 0;
+    uint32_t baseMipLevel = 0;
+    uint32_t mipCount = 0;
+    uint32_t xOffset = 0;
+    uint32_t yOffset = 0;
+    uint32_t yOffsetForUVPlane = 0;
+    uint32_t tileMode = 0;
+    uint32_t hAlign = 0;
+    uint32_t vAlign = 0;
+    uint32_t mipTailStartLod = 0;
+    bool hasGmm = false;
+    bool isDepthResource = false;
+    bool isMediaBlockImage = false;
+
+    bool operator==(const ImageSurfaceStateKey &rhs) const;
+};
+
+class ImageSurfaceStateCache {
+  public:
+    static constexpr size_t maxSurfaceStateSize = 64;
+    static constexpr size_t maxEntries = 64;
+
+    bool find(const ImageSurfaceStateKey &key, void *surfaceState, size_t surfaceStateSize);
+    void store(const ImageSurfaceStateKey &key, const void *surfaceState, size_t surfaceStateSize);
+    size_t getNumEntries();
+
+  protected:
+    struct Entry {
+        ImageSurfaceStateKey key;
+        alignas(8) uint8_t surfaceState[maxSurfaceStateSize];
+    };
+
+    std::mutex mtx;
+    std::vector<Entry> entries;
+    size_t nextEntryToReplace = 0;
+};
+} // namespace NEO
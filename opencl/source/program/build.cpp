@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/compiler_interface/compiler_build_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -126,8 +127,28 @@ cl_int Program::build(
             inputArgs.allowCaching = enableCaching;
             NEO::TranslationOutput compilerOuput = {};
 
-            for (const auto &clDevice : deviceVector) {
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
+            CompilerBuildPool *buildPool = nullptr;
+            std::vector<std::shared_ptr<CompilerBuildPool::Job>> buildJobs;
+            if (DebugManager.flags.EnableCompilerBuildPool.get() == 1) {
+                buildPool = deviceVector[0]->getExecutionEnvironment()->getCompilerBuildPool();
+                // first device is compiled on this thread, remaining devices meanwhile on pool's workers
+                buildJobs.resize(deviceVector.size());
+                for (size_t deviceId = 1U; deviceId < deviceVector.size(); deviceId++) {
+                    buildJobs[deviceId] = buildPool->submit(*pCompilerInterface, deviceVector[deviceId]->getDevice(), inputArgs);
+                }
+            }
+
+            for (size_t deviceId = 0U; deviceId < deviceVector.size(); deviceId++) {
+                auto clDevice = deviceVector[deviceId];
+                auto compilerErr = TranslationOutput::ErrorCode::UnknownError;
+                if (nullptr == buildPool) {
+                    compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
+                } else if (nullptr == buildJobs[deviceId]) {
+                    compilerErr = buildPool->build(*pCompilerInterface, clDevice->getDevice(), inputArgs, compilerOuput);
+                } else if (CompilerBuildPool::Job::Status::Completed == buildPool->wait(buildJobs[deviceId])) {
+                    compilerErr = buildJobs[deviceId]->getErrorCode();
+                    buildJobs[deviceId]->copyOutput(compilerOuput);
+                }
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
                 retVal = asClError(compilerErr);
@@ -145,6 +166,12 @@ cl_int Program::build(
                 this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
                 phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
             }
+            // jobs of devices skipped after an error are still in flight, don't let them outlive this build
+            for (const auto &buildJob : buildJobs) {
+                if (nullptr != buildJob) {
+                    buildPool->wait(buildJob);
+                }
+            }
             if (retVal != CL_SUCCESS) {
                 break;
             }
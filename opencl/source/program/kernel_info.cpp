@@ -12,6 +12,7 @@
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -404,10 +405,28 @@ uint32_t KernelInfo::getConstantBufferSize() const {
 }
 
 bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa) {
+    MemoryTransfers isaTransfers;
+    if (!createKernelAllocation(device, internalIsa, isaTransfers)) {
+        return false;
+    }
+    return MemoryTransferHelper::transferMemoryToAllocations(device, isaTransfers);
+}
+
+bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa, MemoryTransfers &isaTransfers) {
     UNRECOVERABLE_IF(kernelAllocation);
     auto kernelIsaSize = heapInfo.KernelHeapSize;
-    const auto allocType = internalIsa ? GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : GraphicsAllocation::AllocationType::KERNEL_ISA;
-    kernelAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), kernelIsaSize, allocType, device.getDeviceBitfield()});
+    kernelAllocationOffset = 0U;
+    isaHeapAllocator = nullptr;
+    if (!internalIsa && device.getIsaHeapAllocator()) {
+        kernelAllocation = device.getIsaHeapAllocator()->allocate(kernelIsaSize, kernelAllocationOffset);
+        if (kernelAllocation) {
+            isaHeapAllocator = device.getIsaHeapAllocator();
+        }
+    }
+    if (!kernelAllocation) {
+        const auto allocType = internalIsa ? GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : GraphicsAllocation::AllocationType::KERNEL_ISA;
+        kernelAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), kernelIsaSize, allocType, device.getDeviceBitfield()});
+    }
     if (!kernelAllocation) {
         return false;
     }
@@ -415,9 +434,14 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
     auto &hwInfo = device.getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
-    return MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *kernelAllocation),
-                                                            device, kernelAllocation, 0, heapInfo.pKernelHeap,
-                                                            static_cast<size_t>(kernelIsaSize));
+    MemoryTransfer isaTransfer;
+    isaTransfer.dstAllocation = kernelAllocation;
+    isaTransfer.dstOffset = kernelAllocationOffset;
+    isaTransfer.srcMemory = heapInfo.pKernelHeap;
+    isaTransfer.srcSize = static_cast<size_t>(kernelIsaSize);
+    isaTransfer.useBlitter = hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *kernelAllocation);
+    isaTransfers.push_back(isaTransfer);
+    return true;
 }
 
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
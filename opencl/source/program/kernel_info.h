@@ -37,7 +37,9 @@ struct KernelInfo;
 class DispatchInfo;
 struct KernelArgumentType;
 class GraphicsAllocation;
+class IsaHeapAllocator;
 class MemoryManager;
+struct MemoryTransfer;
 
 extern bool useKernelDescriptor;
 
@@ -123,6 +125,7 @@ struct KernelInfo {
     void storePatchToken(const SPatchAllocateSystemThreadSurface *pSystemThreadSurface);
     void storePatchToken(const SPatchAllocateSyncBuffer *pAllocateSyncBuffer);
     GraphicsAllocation *getGraphicsAllocation() const { return this->kernelAllocation; }
+    size_t getIsaOffsetInParentAllocation() const { return this->kernelAllocationOffset; }
     void resizeKernelArgInfoAndRegisterParameter(uint32_t argCount) {
         if (kernelArgInfo.size() <= argCount) {
             kernelArgInfo.resize(argCount + 1);
@@ -185,6 +188,7 @@ struct KernelInfo {
     }
 
     bool createKernelAllocation(const Device &device, bool internalIsa);
+    bool createKernelAllocation(const Device &device, bool internalIsa, std::vector<MemoryTransfer> &isaTransfers);
     void apply(const DeviceInfoKernelPayloadConstants &constants);
 
     std::string attributes;
@@ -207,6 +211,8 @@ struct KernelInfo {
     uint64_t kernelId = 0;
     bool isKernelHeapSubstituted = false;
     GraphicsAllocation *kernelAllocation = nullptr;
+    IsaHeapAllocator *isaHeapAllocator = nullptr; // set when kernelAllocation is an arena shared with other kernels
+    size_t kernelAllocationOffset = 0U;
     DebugData debugData;
     bool computeMode = false;
     const gtpin::igc_info_t *igcInfoForGtpin = nullptr;
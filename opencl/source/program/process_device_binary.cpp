@@ -8,11 +8,13 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/program/program_info_cache.h"
 #include "shared/source/program/program_initialization.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -78,9 +80,12 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, const
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
         // Exported functions reside in instruction heap of one of kernels
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
-        buildInfos[rootDeviceIndex].exportedFunctionsSurface = kernelInfoArray[exportedFunctionHeapId]->getGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(buildInfos[rootDeviceIndex].exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = buildInfos[rootDeviceIndex].exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto exportedFunctionsKernelInfo = kernelInfoArray[exportedFunctionHeapId];
+        buildInfos[rootDeviceIndex].exportedFunctionsSurface = exportedFunctionsKernelInfo->getGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(buildInfos[rootDeviceIndex].exportedFunctionsSurface->getGpuAddressToPatch() +
+                                                              exportedFunctionsKernelInfo->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsKernelInfo->isaHeapAllocator ? exportedFunctionsKernelInfo->heapInfo.KernelHeapSize
+                                                                                      : buildInfos[rootDeviceIndex].exportedFunctionsSurface->getUnderlyingBufferSize();
     }
     Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
@@ -109,16 +114,25 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, const
         updateBuildLog(pDevice->getRootDeviceIndex(), error.c_str(), error.size());
         return CL_INVALID_BINARY;
     } else if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        auto &hwInfo = pDevice->getHardwareInfo();
+        auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+        MemoryTransfers isaTransfers;
+        isaTransfers.reserve(kernelInfoArray.size());
         for (const auto &kernelInfo : kernelInfoArray) {
             if (nullptr == kernelInfo->getGraphicsAllocation()) {
                 continue;
             }
             auto &kernHeapInfo = kernelInfo->heapInfo;
             auto segmentId = &kernelInfo - &kernelInfoArray[0];
-            pDevice->getMemoryManager()->copyMemoryToAllocation(kernelInfo->getGraphicsAllocation(), 0,
-                                                                isaSegmentsForPatching[segmentId].hostPointer,
-                                                                kernHeapInfo.KernelHeapSize);
+            MemoryTransfer isaTransfer;
+            isaTransfer.dstAllocation = kernelInfo->getGraphicsAllocation();
+            isaTransfer.dstOffset = kernelInfo->getIsaOffsetInParentAllocation();
+            isaTransfer.srcMemory = isaSegmentsForPatching[segmentId].hostPointer;
+            isaTransfer.srcSize = kernHeapInfo.KernelHeapSize;
+            isaTransfer.useBlitter = hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *isaTransfer.dstAllocation);
+            isaTransfers.push_back(isaTransfer);
         }
+        MemoryTransferHelper::transferMemoryToAllocations(*pDevice, isaTransfers);
     }
     DBG_LOG(PrintRelocations, NEO::constructRelocationsDebugMessage(this->getSymbols(pDevice->getRootDeviceIndex())));
     return CL_SUCCESS;
@@ -149,7 +163,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
 
     DecodeError decodeError;
     DeviceBinaryFormat singleDeviceBinaryFormat;
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinaryWithCache(programInfo, binary, clDevice.getDevice(), decodeErrors, decodeWarnings);
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
     }
@@ -162,6 +176,25 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
     return this->processProgramInfo(programInfo, clDevice);
 }
 
+bool Program::isArtifactsSharingAllowed(uint32_t rootDeviceIndex, const LinkerInput *linkerInput) const {
+    if (DebugManager.flags.EnableProgramArtifactsSharing.get() != 1) {
+        return false;
+    }
+    // relocated ISA and constants depend on per-program global surfaces, debugger and GT-Pin track and modify ISA per program
+    if ((nullptr == context) || isBuiltIn || kernelDebugEnabled || gtpinIsGTPinInitialized() || (nullptr != linkerInput)) {
+        return false;
+    }
+    if (nullptr == buildInfos[rootDeviceIndex].unpackedDeviceBinary) {
+        return false;
+    }
+    for (const auto &device : clDevices) {
+        if (device->getRootDeviceIndex() != rootDeviceIndex) {
+            return false;
+        }
+    }
+    return true;
+}
+
 cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     auto rootDeviceIndex = clDevice.getRootDeviceIndex();
     auto &kernelInfoArray = buildInfos[rootDeviceIndex].kernelInfoArray;
@@ -184,15 +217,29 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     }
 
     kernelInfoArray = std::move(src.kernelInfos);
+
+    ProgramArtifactsRegistry::Key artifactsKey;
+    ProgramArtifactsRegistry::Artifacts *sharedArtifacts = nullptr;
+    auto deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()), buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+    bool shareArtifacts = isArtifactsSharingAllowed(rootDeviceIndex, linkerInput);
+    if (shareArtifacts) {
+        artifactsKey = ProgramArtifactsRegistry::createKey(rootDeviceIndex, deviceBinary, options);
+        sharedArtifacts = context->getProgramArtifactsRegistry().acquire(artifactsKey, deviceBinary, options, kernelInfoArray.size());
+        buildInfos[rootDeviceIndex].sharedArtifacts = sharedArtifacts;
+    }
+
     auto svmAllocsManager = context ? context->getSVMAllocsManager() : nullptr;
-    if (src.globalConstants.size != 0) {
-        buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalConstants.size, true, linkerInput, src.globalConstants.initData);
+    MemoryTransfers pendingTransfers;
+    if (sharedArtifacts) {
+        buildInfos[rootDeviceIndex].constantSurface = sharedArtifacts->constantSurface;
+    } else if (src.globalConstants.size != 0) {
+        buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalConstants.size, true, linkerInput, src.globalConstants.initData, pendingTransfers);
     }
 
     buildInfos[rootDeviceIndex].globalVarTotalSize = src.globalVariables.size;
 
     if (src.globalVariables.size != 0) {
-        buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalVariables.size, false, linkerInput, src.globalVariables.initData);
+        buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalVariables.size, false, linkerInput, src.globalVariables.initData, pendingTransfers);
         if (clDevice.areOcl21FeaturesEnabled() == false) {
             buildInfos[rootDeviceIndex].globalVarTotalSize = 0u;
         }
@@ -200,8 +247,13 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
 
     for (auto &kernelInfo : kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
-        if (kernelInfo->heapInfo.KernelHeapSize) {
-            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+        if (sharedArtifacts) {
+            auto &kernelIsa = sharedArtifacts->kernelIsas[&kernelInfo - &kernelInfoArray[0]];
+            kernelInfo->kernelAllocation = kernelIsa.allocation;
+            kernelInfo->kernelAllocationOffset = kernelIsa.offset;
+            kernelInfo->isaHeapAllocator = kernelIsa.isaHeapAllocator;
+        } else if (kernelInfo->heapInfo.KernelHeapSize) {
+            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn, pendingTransfers) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
         }
 
         if (retVal != CL_SUCCESS) {
@@ -218,6 +270,14 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
         kernelInfo->apply(deviceInfoConstants);
     }
 
+    if (!MemoryTransferHelper::transferMemoryToAllocations(clDevice.getDevice(), pendingTransfers)) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    if (shareArtifacts && (nullptr == sharedArtifacts)) {
+        buildInfos[rootDeviceIndex].sharedArtifacts = context->getProgramArtifactsRegistry().registerArtifacts(artifactsKey, deviceBinary, options, buildInfos[rootDeviceIndex].constantSurface, kernelInfoArray);
+    }
+
     return linkBinary(&clDevice.getDevice(), src.globalConstants.initData, src.globalVariables.initData);
 }
 
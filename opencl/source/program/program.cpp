@@ -20,6 +20,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -370,7 +371,9 @@ void Program::freeBlockResources() {
         }
         auto kernelInfo = blockKernelManager->getBlockKernelInfo(i);
         DEBUG_BREAK_IF(!kernelInfo->kernelAllocation);
-        if (kernelInfo->kernelAllocation) {
+        if (kernelInfo->isaHeapAllocator) {
+            kernelInfo->isaHeapAllocator->free(kernelInfo->kernelAllocation, kernelInfo->kernelAllocationOffset);
+        } else if (kernelInfo->kernelAllocation) {
             this->executionEnvironment.memoryManager->freeGraphicsMemory(kernelInfo->kernelAllocation);
         }
     }
@@ -378,17 +381,32 @@ void Program::freeBlockResources() {
 
 void Program::cleanCurrentKernelInfo(uint32_t rootDeviceIndex) {
     auto &buildInfo = buildInfos[rootDeviceIndex];
+    if (buildInfo.sharedArtifacts) {
+        bool lastReference = context->getProgramArtifactsRegistry().release(buildInfo.sharedArtifacts);
+        buildInfo.sharedArtifacts = nullptr;
+        if (false == lastReference) {
+            // memory is still used by other programs, it is freed together with the last one
+            for (auto &kernelInfo : buildInfo.kernelInfoArray) {
+                kernelInfo->kernelAllocation = nullptr;
+            }
+            buildInfo.constantSurface = nullptr;
+        }
+    }
     for (auto &kernelInfo : buildInfo.kernelInfoArray) {
         if (kernelInfo->kernelAllocation) {
             //register cache flush in all csrs where kernel allocation was used
-            for (auto &engine : this->executionEnvironment.memoryManager->getRegisteredEngines()) {
+            for (auto &engine : this->executionEnvironment.memoryManager->getRegisteredEnginesSnapshot()) {
                 auto contextId = engine.osContext->getContextId();
                 if (kernelInfo->kernelAllocation->isUsedByOsContext(contextId)) {
                     engine.commandStreamReceiver->registerInstructionCacheFlush();
                 }
             }
 
-            this->executionEnvironment.memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(kernelInfo->kernelAllocation);
+            if (kernelInfo->isaHeapAllocator) {
+                kernelInfo->isaHeapAllocator->free(kernelInfo->kernelAllocation, kernelInfo->kernelAllocationOffset);
+            } else {
+                this->executionEnvironment.memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(kernelInfo->kernelAllocation);
+            }
         }
         delete kernelInfo;
     }
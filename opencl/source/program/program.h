@@ -16,6 +16,7 @@
 #include "opencl/source/api/cl_types.h"
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/helpers/base_object.h"
+#include "opencl/source/program/program_artifacts_registry.h"
 
 #include "cif/builtins/memory/buffer/buffer.h"
 #include "patch_list.h"
@@ -206,6 +207,7 @@ class Program : public BaseObject<_cl_program> {
     void allocateBlockPrivateSurfaces(const ClDevice &clDevice);
     void freeBlockResources();
     void cleanCurrentKernelInfo(uint32_t rootDeviceIndex);
+    bool isArtifactsSharingAllowed(uint32_t rootDeviceIndex, const LinkerInput *linkerInput) const;
 
     const std::string &getOptions() const { return options; }
 
@@ -343,6 +345,8 @@ class Program : public BaseObject<_cl_program> {
 
         std::unique_ptr<char[]> packedDeviceBinary;
         size_t packedDeviceBinarySize = 0U;
+
+        ProgramArtifactsRegistry::Artifacts *sharedArtifacts = nullptr;
     };
 
     std::vector<BuildInfo> buildInfos;
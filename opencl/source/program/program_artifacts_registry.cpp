@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/program/program_artifacts_registry.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+bool ProgramArtifactsRegistry::Key::operator==(const Key &rhs) const {
+    return binaryHash == rhs.binaryHash &&
+           optionsHash == rhs.optionsHash &&
+           binarySize == rhs.binarySize &&
+           rootDeviceIndex == rhs.rootDeviceIndex;
+}
+
+ProgramArtifactsRegistry::Key ProgramArtifactsRegistry::createKey(uint32_t rootDeviceIndex, ArrayRef<const uint8_t> deviceBinary, const std::string &options) {
+    Key key;
+    key.binaryHash = Hash::hash(reinterpret_cast<const char *>(deviceBinary.begin()), deviceBinary.size());
+    key.optionsHash = Hash::hash(options.c_str(), options.size());
+    key.binarySize = deviceBinary.size();
+    key.rootDeviceIndex = rootDeviceIndex;
+    return key;
+}
+
+ProgramArtifactsRegistry::Artifacts *ProgramArtifactsRegistry::acquire(const Key &key, ArrayRef<const uint8_t> deviceBinary, const std::string &options, size_t kernelsCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        if (entry->key == key) {
+            if (entry->kernelIsas.size() != kernelsCount) {
+                return nullptr;
+            }
+            if ((entry->deviceBinary.size() != deviceBinary.size()) || (entry->options != options)) {
+                return nullptr;
+            }
+            if ((false == deviceBinary.empty()) && (0 != memcmp(entry->deviceBinary.data(), deviceBinary.begin(), deviceBinary.size()))) {
+                return nullptr;
+            }
+            entry->refCount++;
+            return entry.get();
+        }
+    }
+    return nullptr;
+}
+
+ProgramArtifactsRegistry::Artifacts *ProgramArtifactsRegistry::registerArtifacts(const Key &key, ArrayRef<const uint8_t> deviceBinary, const std::string &options, GraphicsAllocation *constantSurface, const std::vector<KernelInfo *> &kernelInfos) {
+    auto artifacts = std::make_unique<Artifacts>();
+    artifacts->key = key;
+    artifacts->deviceBinary.assign(deviceBinary.begin(), deviceBinary.end());
+    artifacts->options = options;
+    artifacts->refCount = 1U;
+    artifacts->constantSurface = constantSurface;
+    artifacts->kernelIsas.reserve(kernelInfos.size());
+    for (const auto &kernelInfo : kernelInfos) {
+        KernelIsa kernelIsa;
+        kernelIsa.allocation = kernelInfo->kernelAllocation;
+        kernelIsa.offset = kernelInfo->kernelAllocationOffset;
+        kernelIsa.isaHeapAllocator = kernelInfo->isaHeapAllocator;
+        artifacts->kernelIsas.push_back(kernelIsa);
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        if (entry->key == key) {
+            return nullptr;
+        }
+    }
+    entries.push_back(std::move(artifacts));
+    return entries.rbegin()->get();
+}
+
+bool ProgramArtifactsRegistry::release(Artifacts *artifacts) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = std::find_if(entries.begin(), entries.end(), [artifacts](const std::unique_ptr<Artifacts> &registered) { return registered.get() == artifacts; });
+    UNRECOVERABLE_IF(entry == entries.end());
+    UNRECOVERABLE_IF(artifacts->refCount == 0U);
+    artifacts->refCount--;
+    if (artifacts->refCount > 0U) {
+        return false;
+    }
+    entries.erase(entry);
+    return true;
+}
+
+size_t ProgramArtifactsRegistry::getNumEntries() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+} // namespace NEO
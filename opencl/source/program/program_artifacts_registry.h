@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class IsaHeapAllocator;
+struct KernelInfo;
+
+// Tracks immutable device memory of programs built in a context - kernels' ISA and constant surface,
+// so that programs built from identical device binary and options share it instead of allocating and uploading own copies.
+// Global variables surface is writable by kernels and is never shared.
+class ProgramArtifactsRegistry : NonCopyableOrMovableClass {
+  public:
+    struct Key {
+        uint64_t binaryHash = 0U;
+        uint64_t optionsHash = 0U;
+        size_t binarySize = 0U;
+        uint32_t rootDeviceIndex = 0U;
+
+        bool operator==(const Key &rhs) const;
+    };
+
+    struct KernelIsa {
+        GraphicsAllocation *allocation = nullptr;
+        size_t offset = 0U;
+        IsaHeapAllocator *isaHeapAllocator = nullptr;
+    };
+
+    struct Artifacts {
+        Key key;
+        // kept to tell apart different binaries with colliding key
+        std::vector<uint8_t> deviceBinary;
+        std::string options;
+        uint32_t refCount = 0U;
+        GraphicsAllocation *constantSurface = nullptr;
+        std::vector<KernelIsa> kernelIsas;
+    };
+
+    static Key createKey(uint32_t rootDeviceIndex, ArrayRef<const uint8_t> deviceBinary, const std::string &options);
+
+    // returns artifacts registered for identical device binary and options with added reference or nullptr when there are none
+    Artifacts *acquire(const Key &key, ArrayRef<const uint8_t> deviceBinary, const std::string &options, size_t kernelsCount);
+    // registers memory of a freshly processed program with single reference, returns nullptr when key is already registered
+    Artifacts *registerArtifacts(const Key &key, ArrayRef<const uint8_t> deviceBinary, const std::string &options, GraphicsAllocation *constantSurface, const std::vector<KernelInfo *> &kernelInfos);
+    // returns true when last reference was dropped - caller is then responsible for freeing artifacts' memory
+    bool release(Artifacts *artifacts);
+    size_t getNumEntries();
+
+  protected:
+    std::mutex mtx;
+    std::vector<std::unique_ptr<Artifacts>> entries;
+};
+} // namespace NEO
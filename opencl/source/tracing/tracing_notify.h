@@ -10,6 +10,7 @@
 #include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/tracing/tracing_handle.h"
+#include "opencl/source/utilities/binary_api_tracer.h"
 
 #include <atomic>
 #include <thread>
@@ -29,6 +30,10 @@ namespace HostSideTracing {
 #define TRACING_GET_CLIENT_COUNTER(state) ((state) & (~(HostSideTracing::TRACING_STATE_ENABLED_BIT | HostSideTracing::TRACING_STATE_LOCKED_BIT)))
 
 #define TRACING_ENTER(name, ...)                                                                  \
+    if (NEO::BinaryApiTracer::get() != nullptr) {                                                 \
+        NEO::BinaryApiTracer::getThreadCallArgs().reset(#name);                                   \
+        NEO::BinaryApiTracer::getThreadCallArgs().stash(__VA_ARGS__);                             \
+    }                                                                                             \
     bool isHostSideTracingEnabled_##name = false;                                                 \
     HostSideTracing::name##Tracer tracer_##name;                                                  \
     if (TRACING_GET_ENABLED_BIT(HostSideTracing::tracingState.load(std::memory_order_acquire))) { \
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/utilities/binary_api_tracer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> nextTracerId{1};
+
+struct ThreadBufferCache {
+    ~ThreadBufferCache() {
+        if (buffer) {
+            buffer->markOwnerExited();
+        }
+    }
+    uint64_t tracerId = 0;
+    std::shared_ptr<BinaryApiTraceBuffer> buffer;
+};
+thread_local ThreadBufferCache threadBufferCache;
+thread_local BinaryApiTraceCallArgs threadCallArgs;
+
+std::mutex &getFunctionNamesMutex() {
+    static std::mutex functionNamesMutex;
+    return functionNamesMutex;
+}
+
+std::vector<const char *> &getFunctionNames() {
+    static std::vector<const char *> functionNames;
+    return functionNames;
+}
+
+std::unique_ptr<BinaryApiTracer> createGlobalTracer() {
+    auto fileName = DebugManager.flags.BinaryApiTraceFile.get();
+    if (fileName == "unk") {
+        return nullptr;
+    }
+    return std::make_unique<BinaryApiTracer>(fileName, true);
+}
+} // namespace
+
+constexpr uint32_t BinaryApiTraceFileHeader::magicValue;
+constexpr uint32_t BinaryApiTraceFileHeader::currentVersion;
+constexpr size_t BinaryApiTraceRecord::maxFunctionNameLength;
+constexpr size_t BinaryApiTraceRecord::maxArgs;
+constexpr size_t BinaryApiTraceBuffer::capacity;
+constexpr uint32_t BinaryApiTracer::flushIntervalMilliseconds;
+
+bool BinaryApiTraceBuffer::push(const BinaryApiTraceRecord &record) {
+    auto currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead - tail.load(std::memory_order_acquire) == capacity) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    records[currentHead & (capacity - 1)] = record;
+    head.store(currentHead + 1, std::memory_order_release);
+    return true;
+}
+
+size_t BinaryApiTraceBuffer::drain(std::vector<BinaryApiTraceRecord> &out) {
+    auto currentTail = tail.load(std::memory_order_relaxed);
+    auto currentHead = head.load(std::memory_order_acquire);
+    for (auto position = currentTail; position != currentHead; position++) {
+        out.push_back(records[position & (capacity - 1)]);
+    }
+    tail.store(currentHead, std::memory_order_release);
+    return static_cast<size_t>(currentHead - currentTail);
+}
+
+BinaryApiTracer::BinaryApiTracer(const std::string &fileName, bool startFlusherThread)
+    : tracerId(nextTracerId.fetch_add(1)), fileName(fileName) {
+    pendingRecords.reserve(BinaryApiTraceBuffer::capacity);
+    if (startFlusherThread) {
+        flusherThread = Thread::create(flusherThreadFunc, this);
+    }
+}
+
+BinaryApiTracer::~BinaryApiTracer() {
+    if (flusherThread) {
+        {
+            std::lock_guard<std::mutex> lock(flusherMutex);
+            stopFlusher = true;
+        }
+        flusherCondition.notify_one();
+        flusherThread->join();
+        flusherThread.reset();
+    }
+    flush();
+    if (traceFile) {
+        IoFunctions::fclosePtr(traceFile);
+    }
+}
+
+BinaryApiTracer *BinaryApiTracer::get() {
+    static std::unique_ptr<BinaryApiTracer> globalTracer = createGlobalTracer();
+    return globalTracer.get();
+}
+
+uint32_t BinaryApiTracer::registerFunction(const char *functionName) {
+    std::lock_guard<std::mutex> lock(getFunctionNamesMutex());
+    auto &functionNames = getFunctionNames();
+    functionNames.push_back(functionName);
+    return static_cast<uint32_t>(functionNames.size() - 1);
+}
+
+uint64_t BinaryApiTracer::getTimestamp() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+BinaryApiTraceCallArgs &BinaryApiTracer::getThreadCallArgs() {
+    return threadCallArgs;
+}
+
+void BinaryApiTracer::takeCallArgs(const char *functionName, uint64_t (&args)[BinaryApiTraceRecord::maxArgs]) {
+    if ((threadCallArgs.functionName != nullptr) && (strcmp(threadCallArgs.functionName, functionName) == 0)) {
+        memcpy(args, threadCallArgs.values, sizeof(args));
+    }
+    threadCallArgs = {};
+}
+
+BinaryApiTraceBuffer *BinaryApiTracer::getThreadBuffer() {
+    if (threadBufferCache.tracerId != tracerId) {
+        // buffer of the previous tracer is released by that tracer's next flush
+        if (threadBufferCache.buffer) {
+            threadBufferCache.buffer->markOwnerExited();
+        }
+        auto threadId = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        auto buffer = std::make_shared<BinaryApiTraceBuffer>(threadId);
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.push_back(buffer);
+        }
+        threadBufferCache.tracerId = tracerId;
+        threadBufferCache.buffer = std::move(buffer);
+    }
+    return threadBufferCache.buffer.get();
+}
+
+void BinaryApiTracer::recordApiCall(uint32_t functionId, uint64_t startTimestamp, uint64_t endTimestamp, int64_t retVal, const uint64_t *args) {
+    auto buffer = getThreadBuffer();
+
+    BinaryApiTraceRecord record = {};
+    record.type = static_cast<uint32_t>(BinaryApiTraceRecordType::ApiCall);
+    record.functionId = functionId;
+    record.apiCall.threadId = buffer->getThreadId();
+    record.apiCall.startTimestamp = startTimestamp;
+    record.apiCall.endTimestamp = endTimestamp;
+    record.apiCall.retVal = retVal;
+    if (args) {
+        memcpy(record.apiCall.args, args, sizeof(record.apiCall.args));
+    }
+    buffer->push(record);
+}
+
+void BinaryApiTracer::flush() {
+    std::lock_guard<std::mutex> flushLock(flushMutex);
+
+    pendingRecords.clear();
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto buffer = buffers.begin(); buffer != buffers.end();) {
+            // checked before draining, so an exited owner can't push anything after the last drain
+            auto ownerExited = (*buffer)->hasOwnerExited();
+            auto droppedCount = (*buffer)->takeDroppedCount();
+            if (droppedCount > 0) {
+                BinaryApiTraceRecord record = {};
+                record.type = static_cast<uint32_t>(BinaryApiTraceRecordType::DroppedRecords);
+                record.droppedCount = droppedCount;
+                pendingRecords.push_back(record);
+            }
+            (*buffer)->drain(pendingRecords);
+            buffer = ownerExited ? buffers.erase(buffer) : buffer + 1;
+        }
+    }
+
+    // names are collected after draining, so every drained call already has its name registered
+    std::vector<BinaryApiTraceRecord> nameRecords;
+    {
+        std::lock_guard<std::mutex> lock(getFunctionNamesMutex());
+        auto &functionNames = getFunctionNames();
+        for (; functionNamesWritten < functionNames.size(); functionNamesWritten++) {
+            BinaryApiTraceRecord record = {};
+            record.type = static_cast<uint32_t>(BinaryApiTraceRecordType::FunctionName);
+            record.functionId = functionNamesWritten;
+            strncpy(record.functionName, functionNames[functionNamesWritten], BinaryApiTraceRecord::maxFunctionNameLength);
+            nameRecords.push_back(record);
+        }
+    }
+
+    if (!headerWritten) {
+        BinaryApiTraceFileHeader header;
+        header.recordSize = sizeof(BinaryApiTraceRecord);
+        writeToFile(&header, sizeof(header));
+        headerWritten = true;
+    }
+    if (!nameRecords.empty()) {
+        writeToFile(nameRecords.data(), nameRecords.size() * sizeof(BinaryApiTraceRecord));
+    }
+    if (!pendingRecords.empty()) {
+        writeToFile(pendingRecords.data(), pendingRecords.size() * sizeof(BinaryApiTraceRecord));
+    }
+}
+
+void *BinaryApiTracer::flusherThreadFunc(void *arg) {
+    static_cast<BinaryApiTracer *>(arg)->flusherLoop();
+    return nullptr;
+}
+
+void BinaryApiTracer::flusherLoop() {
+    std::unique_lock<std::mutex> lock(flusherMutex);
+    while (!stopFlusher) {
+        flusherCondition.wait_for(lock, std::chrono::milliseconds(flushIntervalMilliseconds));
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void BinaryApiTracer::writeToFile(const void *data, size_t size) {
+    // opened once, flushed after every write so the trace survives a crash of the application
+    if (traceFile == nullptr) {
+        traceFile = IoFunctions::fopenPtr(fileName.c_str(), "wb");
+        if (traceFile == nullptr) {
+            return;
+        }
+    }
+    fwrite(data, 1, size, traceFile);
+    fflush(traceFile);
+}
+} // namespace NEO
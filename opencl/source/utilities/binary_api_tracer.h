@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace NEO {
+
+// On-disk layout of a binary API trace:
+//   BinaryApiTraceFileHeader followed by a stream of fixed size BinaryApiTraceRecords.
+// A FunctionName record always precedes the first ApiCall record referencing its functionId.
+// Use scripts/decode_binary_api_trace.py to convert a trace into Chrome trace event JSON.
+struct BinaryApiTraceFileHeader {
+    static constexpr uint32_t magicValue = 0x52544142; // "BATR"
+    static constexpr uint32_t currentVersion = 1;
+
+    uint32_t magic = magicValue;
+    uint32_t version = currentVersion;
+    uint32_t recordSize = 0;
+    uint32_t timestampUnitNs = 1;
+};
+
+enum class BinaryApiTraceRecordType : uint32_t {
+    FunctionName = 1,
+    ApiCall = 2,
+    DroppedRecords = 3
+};
+
+struct BinaryApiTraceRecord {
+    static constexpr size_t maxFunctionNameLength = 55;
+    static constexpr size_t maxArgs = 3;
+
+    struct ApiCall {
+        uint64_t threadId;
+        uint64_t startTimestamp;
+        uint64_t endTimestamp;
+        int64_t retVal;
+        uint64_t args[maxArgs];
+    };
+
+    uint32_t type;
+    uint32_t functionId;
+    union {
+        ApiCall apiCall;
+        char functionName[maxFunctionNameLength + 1];
+        uint64_t droppedCount;
+    };
+};
+static_assert(sizeof(BinaryApiTraceRecord) == 64, "Binary API trace record must stay 64 bytes");
+
+// Integers, enums and handles are recorded by value, anything else as 0
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint64_t>::type toBinaryApiTraceArg(const T &arg) {
+    return static_cast<uint64_t>(arg);
+}
+template <typename T>
+uint64_t toBinaryApiTraceArg(T *arg) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg));
+}
+template <typename T>
+typename std::enable_if<!std::is_integral<T>::value && !std::is_enum<T>::value && !std::is_pointer<T>::value, uint64_t>::type toBinaryApiTraceArg(const T &arg) {
+    return 0;
+}
+
+// Leading arguments of the API call in progress on this thread, stashed by TRACING_ENTER
+// and taken over by the API_ENTER scope of the same function.
+struct BinaryApiTraceCallArgs {
+    void reset(const char *functionName) {
+        *this = {};
+        this->functionName = functionName;
+    }
+    // takes pointers to the arguments, the way TRACING_ENTER passes them
+    void stash() {}
+    template <typename T, typename... Rest>
+    void stash(T *arg, Rest... rest) {
+        if (count < BinaryApiTraceRecord::maxArgs) {
+            values[count++] = toBinaryApiTraceArg(*arg);
+            stash(rest...);
+        }
+    }
+
+    const char *functionName = nullptr;
+    uint64_t values[BinaryApiTraceRecord::maxArgs] = {};
+    size_t count = 0;
+};
+
+// Single producer (owning API thread) / single consumer (flusher) ring of records.
+// When full, new records are dropped and counted instead of blocking the API thread.
+class BinaryApiTraceBuffer : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t capacity = 4096;
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be a power of 2");
+
+    explicit BinaryApiTraceBuffer(uint64_t threadId) : threadId(threadId) {}
+
+    uint64_t getThreadId() const { return threadId; }
+    // called by the owning thread when it stops recording, buffer gets released after its last drain
+    void markOwnerExited() { ownerExited.store(true, std::memory_order_release); }
+    bool hasOwnerExited() const { return ownerExited.load(std::memory_order_acquire); }
+    bool push(const BinaryApiTraceRecord &record);
+    size_t drain(std::vector<BinaryApiTraceRecord> &out);
+    uint64_t takeDroppedCount() { return droppedCount.exchange(0, std::memory_order_relaxed); }
+
+  protected:
+    const uint64_t threadId;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> droppedCount{0};
+    std::atomic<bool> ownerExited{false};
+    BinaryApiTraceRecord records[capacity];
+};
+
+class BinaryApiTracer : NonCopyableOrMovableClass {
+  public:
+    BinaryApiTracer(const std::string &fileName, bool startFlusherThread);
+    MOCKABLE_VIRTUAL ~BinaryApiTracer();
+
+    static BinaryApiTracer *get();
+    static uint32_t registerFunction(const char *functionName);
+    static uint64_t getTimestamp();
+
+    static BinaryApiTraceCallArgs &getThreadCallArgs();
+    // args stay zeroed unless they were stashed for this function on this thread
+    static void takeCallArgs(const char *functionName, uint64_t (&args)[BinaryApiTraceRecord::maxArgs]);
+
+    void recordApiCall(uint32_t functionId, uint64_t startTimestamp, uint64_t endTimestamp, int64_t retVal, const uint64_t *args = nullptr);
+    void flush();
+
+    static constexpr uint32_t flushIntervalMilliseconds = 100;
+
+  protected:
+    BinaryApiTraceBuffer *getThreadBuffer();
+    static void *flusherThreadFunc(void *arg);
+    void flusherLoop();
+    MOCKABLE_VIRTUAL void writeToFile(const void *data, size_t size);
+
+    const uint64_t tracerId;
+    std::string fileName;
+    FILE *traceFile = nullptr;
+    bool headerWritten = false;
+    uint32_t functionNamesWritten = 0;
+
+    std::mutex buffersMutex;
+    std::vector<std::shared_ptr<BinaryApiTraceBuffer>> buffers;
+
+    std::mutex flushMutex;
+    std::vector<BinaryApiTraceRecord> pendingRecords;
+
+    std::mutex flusherMutex;
+    std::condition_variable flusherCondition;
+    bool stopFlusher = false;
+    std::unique_ptr<Thread> flusherThread;
+};
+
+// Per API call scope; costs a single pointer check when tracing is disabled.
+class BinaryApiTraceScope {
+  public:
+    BinaryApiTraceScope(uint32_t functionId, const char *functionName, const int *retVal) : functionId(functionId), retVal(retVal) {
+        tracer = BinaryApiTracer::get();
+        if (tracer) {
+            BinaryApiTracer::takeCallArgs(functionName, args);
+            startTimestamp = BinaryApiTracer::getTimestamp();
+        }
+    }
+    ~BinaryApiTraceScope() {
+        if (tracer) {
+            tracer->recordApiCall(functionId, startTimestamp, BinaryApiTracer::getTimestamp(), (retVal != nullptr) ? *retVal : 0, args);
+        }
+    }
+
+  protected:
+    BinaryApiTracer *tracer = nullptr;
+    uint32_t functionId;
+    const int *retVal;
+    uint64_t startTimestamp = 0;
+    uint64_t args[BinaryApiTraceRecord::maxArgs] = {};
+};
+} // namespace NEO
@@ -8,6 +8,7 @@
 #include "opencl/test/unit_test/api/cl_enqueue_migrate_mem_objects_tests.inl"
 #include "opencl/test/unit_test/api/cl_enqueue_native_kernel_tests.inl"
 #include "opencl/test/unit_test/api/cl_enqueue_nd_range_kernel_tests.inl"
+#include "opencl/test/unit_test/api/cl_enqueue_nd_range_kernels_intel_tests.inl"
 #include "opencl/test/unit_test/api/cl_enqueue_read_buffer_rect_tests.inl"
 #include "opencl/test/unit_test/api/cl_enqueue_read_buffer_tests.inl"
 #include "opencl/test/unit_test/api/cl_enqueue_read_image_tests.inl"
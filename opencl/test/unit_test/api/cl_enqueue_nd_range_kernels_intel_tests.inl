@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clEnqueueNDRangeKernelsINTELTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenValidParametersWhenEnqueuingKernelBatchThenSuccessIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    size_t localWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {pKernel, 1, nullptr, globalWorkSize, nullptr}};
+
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 2, kernelDescs, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenNullCommandQueueWhenEnqueuingKernelBatchThenInvalidCommandQueueErrorIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDesc = {pKernel, 1, nullptr, globalWorkSize, nullptr};
+
+    retVal = clEnqueueNDRangeKernelsINTEL(nullptr, 1, &kernelDesc, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+}
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenNoKernelsWhenEnqueuingKernelBatchThenInvalidValueErrorIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDesc = {pKernel, 1, nullptr, globalWorkSize, nullptr};
+
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 0, &kernelDesc, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 1, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenNullKernelInBatchWhenEnqueuingKernelBatchThenInvalidKernelErrorIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{pKernel, 1, nullptr, globalWorkSize, nullptr},
+                                                   {nullptr, 1, nullptr, globalWorkSize, nullptr}};
+
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 2, kernelDescs, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_INVALID_KERNEL, retVal);
+}
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenInvalidWorkDimInBatchWhenEnqueuingKernelBatchThenInvalidValueErrorIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDesc = {pKernel, 4, nullptr, globalWorkSize, nullptr};
+
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 1, &kernelDesc, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    kernelDesc.workDim = 1;
+    kernelDesc.globalWorkSize = nullptr;
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 1, &kernelDesc, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clEnqueueNDRangeKernelsINTELTests, GivenQueueIncapableWhenEnqueuingKernelBatchThenInvalidOperationIsReturned) {
+    size_t globalWorkSize[3] = {1, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDesc = {pKernel, 1, nullptr, globalWorkSize, nullptr};
+
+    this->disableQueueCapabilities(CL_QUEUE_CAPABILITY_KERNEL_INTEL);
+    retVal = clEnqueueNDRangeKernelsINTEL(pCommandQueue, 1, &kernelDesc, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+}
+} // namespace ULT
@@ -183,6 +183,11 @@ TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDCountKernelINTELWhenG
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDCountKernelINTEL));
 }
 
+TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDRangeKernelsINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clEnqueueNDRangeKernelsINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDRangeKernelsINTEL));
+}
+
 TEST_F(clGetExtensionFunctionAddressTests, GivenCSlSetProgramSpecializationConstantWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
     auto retVal = clGetExtensionFunctionAddress("clSetProgramSpecializationConstant");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetProgramSpecializationConstant));
@@ -378,6 +378,38 @@ HWTEST_F(EnqueueHandlerTest, WhenEnqueuingWithOutputEventThenEventIsRegistered)
     mockCmdQ->release();
 }
 
+template <typename GfxFamily>
+class EventSetupTrackingCommandQueueHw : public MockCommandQueueHw<GfxFamily> {
+  public:
+    using MockCommandQueueHw<GfxFamily>::MockCommandQueueHw;
+
+    void setupEvent(EventBuilder &eventBuilder, cl_event *outEvent, uint32_t cmdType) override {
+        auto &csr = static_cast<UltCommandStreamReceiver<GfxFamily> &>(this->getGpgpuCommandStreamReceiver());
+        lockCounterAtEventSetup = csr.recursiveLockCounter.load();
+        MockCommandQueueHw<GfxFamily>::setupEvent(eventBuilder, outEvent, cmdType);
+    }
+
+    uint32_t lockCounterAtEventSetup = std::numeric_limits<uint32_t>::max();
+};
+
+HWTEST_F(EnqueueHandlerTest, givenOutputEventWhenEnqueuingHandlerThenEventIsCreatedBeforeCsrOwnershipIsObtained) {
+    MockKernelWithInternals kernelInternals(*pClDevice, context);
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, kernelInternals.mockKernel);
+    cl_event outputEvent = nullptr;
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto mockCmdQ = std::make_unique<EventSetupTrackingCommandQueueHw<FamilyType>>(context, pClDevice, nullptr);
+    auto lockCounterBeforeEnqueue = csr.recursiveLockCounter.load();
+
+    mockCmdQ->template enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(nullptr, 0, false, multiDispatchInfo, 0, nullptr, &outputEvent);
+
+    ASSERT_NE(nullptr, outputEvent);
+    EXPECT_EQ(lockCounterBeforeEnqueue, mockCmdQ->lockCounterAtEventSetup);
+    EXPECT_LT(lockCounterBeforeEnqueue, csr.recursiveLockCounter.load());
+
+    castToObjectOrAbort<Event>(outputEvent)->release();
+}
+
 HWTEST_F(EnqueueHandlerTest, givenEnqueueHandlerWhenAddPatchInfoCommentsForAUBDumpIsNotSetThenPatchInfoDataIsNotTransferredToCSR) {
     auto csr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     auto mockHelper = new MockFlatBatchBufferHelper<FamilyType>(*pDevice->executionEnvironment);
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/cmd_parse/hw_parse.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/event/event.h"
+#include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "opencl/test/unit_test/mocks/mock_program.h"
+
+using namespace NEO;
+
+struct EnqueueKernelsBatchTest : public HelloWorldTest<HelloWorldFixtureFactory>,
+                                 public HardwareParse {
+    void SetUp() override {
+        HelloWorldTest<HelloWorldFixtureFactory>::SetUp();
+        HardwareParse::SetUp();
+    }
+
+    void TearDown() override {
+        HardwareParse::TearDown();
+        HelloWorldTest<HelloWorldFixtureFactory>::TearDown();
+    }
+
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+};
+
+HWTEST_F(EnqueueKernelsBatchTest, givenBatchOfKernelsWhenEnqueuingKernelsThenOneWalkerPerKernelIsProgrammedInSingleTask) {
+    cl_ndrange_kernel_desc_intel kernelDescs[3] = {{pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {pKernel, 1, nullptr, globalWorkSize, nullptr}};
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueKernels(3, kernelDescs, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 1, pCmdQ->taskCount);
+
+    parseCommands<FamilyType>(*pCmdQ);
+    auto walkers = findAll<typename FamilyType::WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(3u, walkers.size());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueKernelsBatchTest, givenBatchOfKernelsWhenEnqueuingKernelsThenSingleInterfaceDescriptorLoadIsProgrammed) {
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {pKernel, 1, nullptr, globalWorkSize, localWorkSize}};
+
+    auto retVal = pCmdQ->enqueueKernels(2, kernelDescs, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    parseCommands<FamilyType>(*pCmdQ);
+    auto idLoads = findAll<typename FamilyType::MEDIA_INTERFACE_DESCRIPTOR_LOAD *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(1u, idLoads.size());
+}
+
+HWTEST_F(EnqueueKernelsBatchTest, givenInvalidWorkGroupSizeForOneKernelWhenEnqueuingKernelsThenErrorIsReturnedAndNothingIsSubmitted) {
+    size_t invalidLocalWorkSize[3] = {0, 1, 1};
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {pKernel, 1, nullptr, globalWorkSize, invalidLocalWorkSize}};
+    auto taskCountBefore = pCmdQ->taskCount;
+    cl_event event = reinterpret_cast<cl_event>(0x1234);
+
+    auto retVal = pCmdQ->enqueueKernels(2, kernelDescs, 0, nullptr, &event);
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, retVal);
+    EXPECT_EQ(nullptr, event);
+    EXPECT_EQ(taskCountBefore, pCmdQ->taskCount);
+}
+
+HWTEST_F(EnqueueKernelsBatchTest, givenKernelWithPrintfWhenEnqueuingKernelsThenInvalidKernelIsReturned) {
+    SPatchAllocateStatelessPrintfSurface printfSurface = {};
+    auto pKernelInfo = std::make_unique<KernelInfo>();
+    pKernelInfo->patchInfo.pAllocateStatelessPrintfSurface = &printfSurface;
+    SPatchExecutionEnvironment executionEnvironment = {};
+    pKernelInfo->patchInfo.executionEnvironment = &executionEnvironment;
+    MockProgram program(toClDeviceVector(*pClDevice));
+    MockKernel printfKernel(&program, *pKernelInfo);
+    ASSERT_TRUE(printfKernel.hasPrintfOutput());
+
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{pKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {&printfKernel, 1, nullptr, globalWorkSize, localWorkSize}};
+
+    auto retVal = pCmdQ->enqueueKernels(2, kernelDescs, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_KERNEL, retVal);
+}
+
+HWTEST_F(EnqueueKernelsBatchTest, givenKernelRequiringCacheFlushAfterWalkerWhenItIsNotFirstInBatchThenBatchIsSplitAndSuccessIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCacheFlushAfterWalker.set(1);
+    MockKernelWithInternals mockKernel(*pClDevice);
+
+    cl_ndrange_kernel_desc_intel kernelDescs[3] = {{mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {mockKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize}};
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueKernels(3, kernelDescs, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 3, pCmdQ->taskCount);
+}
+
+HWTEST_F(EnqueueKernelsBatchTest, givenKernelsWithDifferentDispatchFlagsWhenEnqueuingKernelsThenEachGroupIsSubmittedSeparatelyWithItsOwnFlags) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals statelessWritesKernel(*pClDevice);
+    MockKernelWithInternals noStatelessWritesKernel(*pClDevice);
+    statelessWritesKernel.mockKernel->containsStatelessWrites = true;
+    noStatelessWritesKernel.mockKernel->containsStatelessWrites = false;
+
+    cl_ndrange_kernel_desc_intel kernelDescs[3] = {{statelessWritesKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {statelessWritesKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {noStatelessWritesKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize}};
+    auto taskCountBefore = pCmdQ->taskCount;
+    cl_event event = nullptr;
+
+    auto retVal = pCmdQ->enqueueKernels(3, kernelDescs, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 2, pCmdQ->taskCount);
+    EXPECT_EQ(L3CachingSettings::l3AndL1On, csr.recordedDispatchFlags.l3CacheSettings);
+
+    ASSERT_NE(nullptr, event);
+    auto eventObject = castToObject<Event>(event);
+    EXPECT_EQ(pCmdQ->taskCount, eventObject->peekTaskCount());
+    eventObject->release();
+}
+
+HWTEST_F(EnqueueKernelsBatchTest, givenKernelsWithDifferentThreadArbitrationPolicyWhenEnqueuingKernelsThenBatchIsSplit) {
+    MockKernelWithInternals roundRobinKernel(*pClDevice);
+    MockKernelWithInternals ageBasedKernel(*pClDevice);
+    roundRobinKernel.mockKernel->threadArbitrationPolicy = ThreadArbitrationPolicy::RoundRobin;
+    ageBasedKernel.mockKernel->threadArbitrationPolicy = ThreadArbitrationPolicy::AgeBased;
+
+    cl_ndrange_kernel_desc_intel kernelDescs[2] = {{roundRobinKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize},
+                                                   {ageBasedKernel.mockKernel, 1, nullptr, globalWorkSize, localWorkSize}};
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueKernels(2, kernelDescs, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 2, pCmdQ->taskCount);
+}
@@ -993,3 +993,133 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenCreateFullFilePath
     fullName = AUBCommandStreamReceiver::createFullFilePath(*defaultHwInfo, "aubfile");
     EXPECT_NE(std::string::npos, fullName.find("2tx"));
 }
+
+struct WriteCountingAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
+    void write(const char *data, size_t size) override {
+        writtenSize += size;
+    }
+    size_t writtenSize = 0;
+};
+
+TEST(AubFileStreamTest, givenSkipUnchangedMemoryWhenSameContentIsWrittenToSamePhysicalAddressThenItIsWrittenOnce) {
+    WriteCountingAubFileStream stream;
+    stream.skipUnchangedMemoryWrites = true;
+
+    uint32_t memory[16] = {};
+    stream.writeMemory(0x1000, memory, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeOfSingleWrite = stream.writtenSize;
+    EXPECT_NE(0u, sizeOfSingleWrite);
+
+    stream.writeMemory(0x1000, memory, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(sizeOfSingleWrite, stream.writtenSize);
+
+    memory[3] = 1;
+    stream.writeMemory(0x1000, memory, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(2 * sizeOfSingleWrite, stream.writtenSize);
+
+    stream.writeMemory(0x2000, memory, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(3 * sizeOfSingleWrite, stream.writtenSize);
+
+    stream.writeMemoryWriteHeader(0x1000, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeAfterHeader = stream.writtenSize;
+    stream.writeMemory(0x1000, memory, sizeof(memory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(sizeAfterHeader + sizeOfSingleWrite, stream.writtenSize);
+}
+
+TEST(AubFileStreamTest, givenSkipUnchangedMemoryWhenOverlappingWriteStartsAtDifferentAddressThenPreviouslyDumpedPagesAreWrittenAgain) {
+    WriteCountingAubFileStream stream;
+    stream.skipUnchangedMemoryWrites = true;
+
+    std::vector<uint8_t> memory(2 * MemoryConstants::pageSize, 0xaa);
+    stream.writeMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeOfFullWrite = stream.writtenSize;
+
+    uint8_t overlappingMemory[0x100] = {};
+    stream.writeMemory(0x10800, overlappingMemory, sizeof(overlappingMemory), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeAfterOverlappingWrite = stream.writtenSize;
+    EXPECT_LT(sizeOfFullWrite, sizeAfterOverlappingWrite);
+
+    stream.writeMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(sizeAfterOverlappingWrite + sizeOfFullWrite, stream.writtenSize);
+
+    stream.writeMemory(0x10000 + MemoryConstants::pageSize, memory.data(), MemoryConstants::pageSize, AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(sizeAfterOverlappingWrite + sizeOfFullWrite, stream.writtenSize);
+}
+
+TEST(AubFileStreamTest, givenSkipUnchangedMemoryWhenDumpedMemoryIsInvalidatedThenSameContentIsWrittenAgain) {
+    WriteCountingAubFileStream stream;
+    stream.skipUnchangedMemoryWrites = true;
+
+    std::vector<uint8_t> memory(2 * MemoryConstants::pageSize, 0xaa);
+    stream.writeMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    auto sizeOfFullWrite = stream.writtenSize;
+
+    stream.invalidateDumpedMemory(0x10000 + MemoryConstants::pageSize + 0x10, 0x10);
+    EXPECT_EQ(1u, stream.dumpedPages.size());
+
+    stream.writeMemory(0x10000, memory.data(), memory.size(), AubMemDump::AddressSpaceValues::TraceNonlocal, 0);
+    EXPECT_EQ(2 * sizeOfFullWrite, stream.writtenSize);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedMemoryWhenProcessingResidencyThenDumpedMemoryOfGpuWritableAllocationsIsInvalidated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AUBDumpSkipUnchangedMemory.set(true);
+
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    aubCsr->aubManager = nullptr;
+    aubCsr->stream = mockAubFileStream.get();
+
+    MockGraphicsAllocation buffer(reinterpret_cast<void *>(0x10000), MemoryConstants::pageSize);
+    buffer.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    MockGraphicsAllocation isa(reinterpret_cast<void *>(0x20000), MemoryConstants::pageSize);
+    isa.setAllocationType(GraphicsAllocation::AllocationType::KERNEL_ISA);
+    ResidencyContainer allocationsForResidency = {&buffer, &isa};
+    aubCsr->processResidency(allocationsForResidency, 0u);
+
+    EXPECT_EQ(MemoryConstants::pageSize, mockAubFileStream->invalidatedDumpedMemorySize);
+}
+
+HWTEST_F(AubFileStreamTests, givenSkipUnchangedMemoryDisabledWhenProcessingResidencyThenDumpedMemoryIsNotInvalidated) {
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+    auto mockAubFileStream = std::make_unique<MockAubFileStream>();
+    aubCsr->aubManager = nullptr;
+    aubCsr->stream = mockAubFileStream.get();
+
+    MockGraphicsAllocation buffer(reinterpret_cast<void *>(0x10000), MemoryConstants::pageSize);
+    buffer.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    ResidencyContainer allocationsForResidency = {&buffer};
+    aubCsr->processResidency(allocationsForResidency, 0u);
+
+    EXPECT_EQ(0u, mockAubFileStream->invalidatedDumpedMemorySize);
+}
+
+TEST(AubFileStreamTest, givenAsyncFileWritesWhenDataIsWrittenAndFlushedThenFileContainsAllDataInOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AUBDumpAsyncFileWrites.set(true);
+
+    std::string fileName = "async_file_writes.aub";
+    AUBCommandStreamReceiver::AubFileStream stream;
+    stream.open(fileName.c_str());
+    ASSERT_TRUE(stream.isOpen());
+    EXPECT_NE(nullptr, stream.asyncWriter.get());
+
+    std::vector<char> data(AsyncFileWriter::defaultChunkSize + 100);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i % 251);
+    }
+    stream.write(data.data(), 100);
+    stream.write(data.data() + 100, data.size() - 100);
+    stream.flush();
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> fileData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    EXPECT_EQ(data, fileData);
+
+    stream.close();
+    EXPECT_EQ(nullptr, stream.asyncWriter.get());
+    std::remove(fileName.c_str());
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/aub_mem_dump/aub_alloc_dump.h"
+#include "shared/source/aub_mem_dump/page_table_entry_bits.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/engine_node_helper.h"
@@ -13,6 +14,8 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_banks.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/helpers/variable_backup.h"
@@ -39,11 +42,14 @@
 #include "opencl/test/unit_test/mocks/mock_os_context.h"
 #include "opencl/test/unit_test/mocks/mock_platform.h"
 #include "opencl/test/unit_test/mocks/mock_tbx_csr.h"
+#include "opencl/test/unit_test/mocks/mock_tbx_sockets.h"
+#include "opencl/test/unit_test/mocks/mock_tbx_stream.h"
 #include "test.h"
 
 #include "tbx_command_stream_fixture.h"
 
 #include <cstdint>
+#include <deque>
 
 using namespace NEO;
 
@@ -1093,3 +1099,273 @@ HWTEST_F(TbxCommandStreamTests, givenGraphicsAllocationWhenDumpAllocationIsCalle
 
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
+
+struct RecordingTbxSockets : public MockTbxSockets {
+    bool writeMemory(uint64_t offset, const void *data, size_t size, uint32_t type) override {
+        // page table entries are single qwords
+        if (size > sizeof(uint64_t)) {
+            dataWrites.push_back({offset, const_cast<void *>(data), size});
+        }
+        return MockTbxSockets::writeMemory(offset, data, size, type);
+    }
+    bool readMemoryRanges(const TbxMemoryRange *ranges, size_t count) override {
+        readRanges.insert(readRanges.end(), ranges, ranges + count);
+        return true;
+    }
+    std::vector<TbxMemoryRange> dataWrites;
+    std::vector<TbxMemoryRange> readRanges;
+};
+
+HWTEST_F(TbxCommandStreamTests, givenTbxCsrWhenWritingAndDownloadingPhysicallyContiguousPagesThenSingleCoalescedRequestIsSent) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), 2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), gfxAllocation->getUnderlyingBuffer(), 2 * MemoryConstants::pageSize, 0, 0);
+    ASSERT_EQ(1u, sockets->dataWrites.size());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, sockets->dataWrites[0].size);
+    EXPECT_EQ(gfxAllocation->getUnderlyingBuffer(), sockets->dataWrites[0].memory);
+
+    tbxCsr.downloadAllocation(*gfxAllocation);
+    ASSERT_EQ(1u, sockets->readRanges.size());
+    EXPECT_EQ(sockets->dataWrites[0].addr, sockets->readRanges[0].addr);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, sockets->readRanges[0].size);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenPhysicallyContiguousPagesExceedingMaxCoalescedSizeWhenWritingAndDownloadingThenRequestsAreSplitAtMaxCoalescedSize) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    constexpr size_t maxCoalescedMemorySize = TbxCommandStreamReceiverHw<FamilyType>::maxCoalescedMemorySize;
+    constexpr size_t allocationSize = maxCoalescedMemorySize + MemoryConstants::pageSize;
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), allocationSize, GraphicsAllocation::AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), gfxAllocation->getUnderlyingBuffer(), allocationSize, 0, 0);
+    ASSERT_EQ(2u, sockets->dataWrites.size());
+    EXPECT_EQ(maxCoalescedMemorySize, sockets->dataWrites[0].size);
+    EXPECT_EQ(MemoryConstants::pageSize, sockets->dataWrites[1].size);
+    EXPECT_EQ(ptrOffset(gfxAllocation->getUnderlyingBuffer(), maxCoalescedMemorySize), sockets->dataWrites[1].memory);
+
+    tbxCsr.downloadAllocation(*gfxAllocation);
+    ASSERT_EQ(2u, sockets->readRanges.size());
+    EXPECT_EQ(maxCoalescedMemorySize, sockets->readRanges[0].size);
+    EXPECT_EQ(MemoryConstants::pageSize, sockets->readRanges[1].size);
+    EXPECT_EQ(ptrOffset(gfxAllocation->getUnderlyingBuffer(), maxCoalescedMemorySize), sockets->readRanges[1].memory);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+// Answers read requests in order, like the TBX server, and records how many requests were awaiting an answer at once
+class MockTbxServerSocketsImp : public TbxSocketsImp {
+  public:
+    static constexpr size_t requestSize = sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ);
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        EXPECT_EQ(0u, sizeInBytes % requestSize);
+        for (size_t offset = 0; offset < sizeInBytes; offset += requestSize) {
+            HAS_MSG request;
+            memcpy(&request, ptrOffset(buffer, offset), requestSize);
+            pendingRequests.push_back(request);
+        }
+        maxPendingRequests = std::max(maxPendingRequests, pendingRequests.size());
+        return true;
+    }
+
+    bool getResponseData(void *buffer, size_t sizeInBytes) override {
+        if (pendingRequests.empty()) {
+            return false;
+        }
+        auto &request = pendingRequests.front();
+        if (!responseHeaderSent) {
+            HAS_MSG response;
+            memset(&response, 0, sizeof(response));
+            response.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+            response.hdr.trans_id = request.hdr.trans_id;
+            memcpy(buffer, &response, sizeInBytes);
+            responseHeaderSent = true;
+            return true;
+        }
+        EXPECT_EQ(request.u.read_req.size, sizeInBytes);
+        memset(buffer, static_cast<int>(request.u.read_req.address), sizeInBytes);
+        pendingRequests.pop_front();
+        responseHeaderSent = false;
+        return true;
+    }
+
+    std::deque<HAS_MSG> pendingRequests;
+    size_t maxPendingRequests = 0;
+    bool responseHeaderSent = false;
+};
+
+TEST(TbxSocketsImpTest, givenMoreRangesThanOutstandingRequestsLimitWhenReadingMemoryRangesThenRequestsAreSentInWindowsAndAllRangesAreRead) {
+    constexpr size_t rangesCount = 2 * TbxSocketsImp::maxOutstandingReadRequests + 3;
+    uint8_t memory[rangesCount][8] = {};
+    TbxMemoryRange ranges[rangesCount];
+    for (size_t i = 0; i < rangesCount; i++) {
+        ranges[i] = {i + 1, memory[i], sizeof(memory[i])};
+    }
+
+    MockTbxServerSocketsImp sockets;
+    EXPECT_TRUE(sockets.readMemoryRanges(ranges, rangesCount));
+    EXPECT_EQ(TbxSocketsImp::maxOutstandingReadRequests, sockets.maxPendingRequests);
+    EXPECT_TRUE(sockets.pendingRequests.empty());
+    for (size_t i = 0; i < rangesCount; i++) {
+        for (auto byte : memory[i]) {
+            EXPECT_EQ(static_cast<uint8_t>(i + 1), byte);
+        }
+    }
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedMemoryWhenWritingMemoryAgainThenOnlyChangedPagesAreSent) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+    DebugManager.flags.TbxSkipUnchangedMemory.set(true);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), 2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+    auto cpuAddress = reinterpret_cast<uint8_t *>(gfxAllocation->getUnderlyingBuffer());
+    memset(cpuAddress, 0, 2 * MemoryConstants::pageSize);
+
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), cpuAddress, 2 * MemoryConstants::pageSize, 0, 0);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    sockets->dataWrites.clear();
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), cpuAddress, 2 * MemoryConstants::pageSize, 0, 0);
+    EXPECT_EQ(0u, sockets->dataWrites.size());
+
+    cpuAddress[MemoryConstants::pageSize] = 1;
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), cpuAddress, 2 * MemoryConstants::pageSize, 0, 0);
+    ASSERT_EQ(1u, sockets->dataWrites.size());
+    EXPECT_EQ(cpuAddress + MemoryConstants::pageSize, sockets->dataWrites[0].memory);
+    EXPECT_EQ(MemoryConstants::pageSize, sockets->dataWrites[0].size);
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedMemoryWhenGpuWritableAllocationWasSubmittedThenItsPagesAreWrittenAgainUntilDownloaded) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+    DebugManager.flags.TbxSkipUnchangedMemory.set(true);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    tbxCsr.setupContext(osContext);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+    ResidencyContainer allocationsForResidency = {gfxAllocation};
+
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    sockets->dataWrites.clear();
+    tbxCsr.dumpTbxNonWritable = true;
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    tbxCsr.downloadAllocation(*gfxAllocation);
+    sockets->dataWrites.clear();
+    tbxCsr.dumpTbxNonWritable = true;
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, sockets->dataWrites.size());
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedMemoryWhenGpuReadOnlyAllocationIsSubmittedAgainThenItsPagesAreSkipped) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+    DebugManager.flags.TbxSkipUnchangedMemory.set(true);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false, false, false);
+    tbxCsr.setupContext(osContext);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM, pDevice->getDeviceBitfield()});
+    ResidencyContainer allocationsForResidency = {gfxAllocation};
+
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    sockets->dataWrites.clear();
+    tbxCsr.processResidency(allocationsForResidency, 0u);
+    EXPECT_EQ(0u, sockets->dataWrites.size());
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedMemoryWhenPageIsWrittenWithDifferentEntryBitsThenItIsWrittenAgain) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.UseAubStream.set(false);
+    DebugManager.flags.TbxSkipUnchangedMemory.set(true);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get(), false, 1);
+    executionEnvironment.initializeMemoryManager();
+    MockTbxCsr<FamilyType> tbxCsr(executionEnvironment, 1);
+    auto sockets = new RecordingTbxSockets;
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = sockets;
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, pDevice->getDeviceBitfield()});
+
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), gfxAllocation->getUnderlyingBuffer(), MemoryConstants::pageSize, 0, 0);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    sockets->dataWrites.clear();
+    tbxCsr.writeMemory(gfxAllocation->getGpuAddress(), gfxAllocation->getUnderlyingBuffer(), MemoryConstants::pageSize, 0, 1llu << PageTableEntry::writableBit);
+    EXPECT_EQ(1u, sockets->dataWrites.size());
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedMemoryAndAubManagerWhenWritingAllocationThenMemoryIsWrittenThroughAubManagerEveryTime) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.TbxSkipUnchangedMemory.set(true);
+
+    MockTbxCsr<FamilyType> tbxCsr{*pDevice->executionEnvironment, pDevice->getDeviceBitfield()};
+    ASSERT_NE(nullptr, tbxCsr.aubManager);
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto gfxAllocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM, pDevice->getDeviceBitfield()});
+
+    for (int i = 0; i < 2; i++) {
+        tbxCsr.writeMemoryWithAubManagerCalled = false;
+        tbxCsr.writeMemory(*gfxAllocation);
+        EXPECT_TRUE(tbxCsr.writeMemoryWithAubManagerCalled);
+        EXPECT_FALSE(tbxCsr.writeMemoryCalled);
+    }
+
+    memoryManager->freeGraphicsMemory(gfxAllocation);
+}
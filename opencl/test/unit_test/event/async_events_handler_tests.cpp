@@ -323,6 +323,39 @@ TEST_F(AsyncEventsHandlerTests, givenRegistredEventsWhenProcessIsCalledThenRetur
     event3->setStatus(CL_COMPLETE);
 }
 
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsFromOneCsrWhenTagIsUpdatedThenOnlyCompletedEventsAreUnregisteredInTaskCountOrder) {
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event3->setTaskStamp(0, 3);
+
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event3.get());
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    handler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+
+    EXPECT_EQ(event1.get(), handler->process());
+    ASSERT_EQ(1u, handler->submittedEvents.size());
+    EXPECT_EQ(3u, handler->submittedEvents.begin()->second.size());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 1;
+    EXPECT_EQ(event2.get(), handler->process());
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(0, event2Counter);
+    EXPECT_EQ(0, event3Counter);
+    EXPECT_EQ(2u, handler->submittedEvents.begin()->second.size());
+    EXPECT_EQ(1, event1->getRefInternalCount());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 3;
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
 TEST_F(AsyncEventsHandlerTests, givenEventWithoutCallbacksWhenProcessedThenDontReturnAsSleepCandidate) {
     event1->setTaskStamp(0, 1);
     event2->setTaskStamp(0, 2);
@@ -7,6 +7,7 @@
 
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/device/device.h"
@@ -15,6 +16,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/device_factory.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
@@ -29,6 +31,8 @@
 #include "opencl/test/unit_test/mocks/mock_memory_operations_handler.h"
 #include "test.h"
 
+#include <set>
+
 using namespace NEO;
 
 TEST(ExecutionEnvironment, givenDefaultConstructorWhenItIsCalledThenExecutionEnvironmentHasInitialRefCountZero) {
@@ -68,6 +72,46 @@ TEST(ExecutionEnvironment, WhenCreatingDevicesThenThoseDevicesAddRefcountsToExec
     EXPECT_EQ(expectedRefCounts, executionEnvironment->getRefInternalCount());
 }
 
+TEST(ExecutionEnvironment, givenParallelRootDeviceInitializationWhenCreatingDevicesThenDevicesAreReturnedInRootDeviceIndexOrderWithUniqueContexts) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CreateMultipleRootDevices.set(4);
+    DebugManager.flags.EnableParallelRootDeviceInitialization.set(true);
+    auto executionEnvironment = new ExecutionEnvironment();
+
+    auto devices = DeviceFactory::createDevices(*executionEnvironment);
+    ASSERT_EQ(4u, devices.size());
+
+    std::set<uint32_t> contextIds;
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < devices.size(); rootDeviceIndex++) {
+        EXPECT_EQ(rootDeviceIndex, devices[rootDeviceIndex]->getRootDeviceIndex());
+        for (auto &engine : devices[rootDeviceIndex]->getEngines()) {
+            EXPECT_TRUE(contextIds.insert(engine.osContext->getContextId()).second);
+        }
+    }
+    EXPECT_EQ(executionEnvironment->memoryManager->getRegisteredEnginesCount(), contextIds.size());
+}
+
+TEST(ExecutionEnvironment, givenParallelRootDeviceInitializationWhenCreatingDevicesThenRegisteredEnginesAndDefaultEngineMatchSequentialCreation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CreateMultipleRootDevices.set(4);
+    DebugManager.flags.EnableParallelRootDeviceInitialization.set(true);
+    auto executionEnvironment = new ExecutionEnvironment();
+
+    auto devices = DeviceFactory::createDevices(*executionEnvironment);
+    ASSERT_EQ(4u, devices.size());
+
+    auto memoryManager = executionEnvironment->memoryManager.get();
+    auto registeredEngines = memoryManager->getRegisteredEnginesSnapshot();
+    ASSERT_NE(0u, registeredEngines.size());
+    for (size_t i = 1; i < registeredEngines.size(); i++) {
+        EXPECT_LE(registeredEngines[i - 1].commandStreamReceiver->getRootDeviceIndex(), registeredEngines[i].commandStreamReceiver->getRootDeviceIndex());
+    }
+
+    auto defaultEngineIndex = devices.back()->getDefaultEngineIndex();
+    EXPECT_EQ(0u, registeredEngines[defaultEngineIndex].commandStreamReceiver->getRootDeviceIndex());
+    EXPECT_EQ(registeredEngines[defaultEngineIndex].osContext, memoryManager->getDefaultEngineOsContext());
+}
+
 TEST(ExecutionEnvironment, givenDeviceThatHaveRefferencesAfterPlatformIsDestroyedThenDeviceIsStillUsable) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.CreateMultipleSubDevices.set(1);
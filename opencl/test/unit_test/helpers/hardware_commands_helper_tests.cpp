@@ -98,6 +98,74 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenProgramInterfaceDescriptor
     EXPECT_EQ(sizeof(INTERFACE_DESCRIPTOR_DATA), usedIndirectHeapAfter - usedIndirectHeapBefore);
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenInterfaceDescriptorSentForKernelWhenSendingItAgainWithDifferentHeapOffsetsThenTemplateIsReusedAndOnlyOffsetsArePatched) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+
+    auto &indirectHeap = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    indirectHeap.getSpace(2 * sizeof(INTERFACE_DESCRIPTOR_DATA));
+
+    HardwareCommandsHelper<FamilyType>::sendInterfaceDescriptorData(
+        indirectHeap, 0, 0x1000, 64, 32, 0x40, 0x80, 0, 4, kernel, 0, pDevice->getPreemptionMode(), nullptr, pDevice->getHardwareInfo());
+    EXPECT_TRUE(kernel.getInterfaceDescriptorTemplate().valid);
+
+    HardwareCommandsHelper<FamilyType>::sendInterfaceDescriptorData(
+        indirectHeap, sizeof(INTERFACE_DESCRIPTOR_DATA), 0x1000, 64, 32, 0x100, 0x200, 0, 4, kernel, 0, pDevice->getPreemptionMode(), nullptr, pDevice->getHardwareInfo());
+
+    auto firstInterfaceDescriptor = reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(indirectHeap.getCpuBase());
+    auto secondInterfaceDescriptor = firstInterfaceDescriptor + 1;
+
+    EXPECT_EQ(0x40u, firstInterfaceDescriptor->getBindingTablePointer());
+    EXPECT_EQ(0x80u, firstInterfaceDescriptor->getSamplerStatePointer());
+    EXPECT_EQ(0x100u, secondInterfaceDescriptor->getBindingTablePointer());
+    EXPECT_EQ(0x200u, secondInterfaceDescriptor->getSamplerStatePointer());
+
+    secondInterfaceDescriptor->setBindingTablePointer(0x40);
+    secondInterfaceDescriptor->setSamplerStatePointer(0x80);
+    EXPECT_EQ(0, memcmp(firstInterfaceDescriptor, secondInterfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA)));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenInterfaceDescriptorTemplateWhenKernelSlmSizeChangesThenTemplateIsRebuilt) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+
+    auto &indirectHeap = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    indirectHeap.getSpace(2 * sizeof(INTERFACE_DESCRIPTOR_DATA));
+
+    kernel.setTotalSLMSize(0);
+    HardwareCommandsHelper<FamilyType>::sendInterfaceDescriptorData(
+        indirectHeap, 0, 0x1000, 64, 32, 0x40, 0x80, 0, 4, kernel, 0, pDevice->getPreemptionMode(), nullptr, pDevice->getHardwareInfo());
+
+    kernel.setTotalSLMSize(4 * KB);
+    HardwareCommandsHelper<FamilyType>::sendInterfaceDescriptorData(
+        indirectHeap, sizeof(INTERFACE_DESCRIPTOR_DATA), 0x1000, 64, 32, 0x40, 0x80, 0, 4, kernel, 0, pDevice->getPreemptionMode(), nullptr, pDevice->getHardwareInfo());
+
+    auto firstInterfaceDescriptor = reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(indirectHeap.getCpuBase());
+    auto secondInterfaceDescriptor = firstInterfaceDescriptor + 1;
+
+    auto expectedSlmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(HwHelperHw<FamilyType>::get().computeSlmValues(4 * KB));
+    EXPECT_NE(firstInterfaceDescriptor->getSharedLocalMemorySize(), secondInterfaceDescriptor->getSharedLocalMemorySize());
+    EXPECT_EQ(expectedSlmSize, secondInterfaceDescriptor->getSharedLocalMemorySize());
+    EXPECT_EQ(4 * KB, kernel.getInterfaceDescriptorTemplate().key.slmTotalSize);
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenInterfaceDescriptorTemplatesDisabledWhenSendingInterfaceDescriptorThenTemplateIsNotStored) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableInterfaceDescriptorTemplates.set(0);
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto &kernel = *mockKernelWithInternal->mockKernel;
+
+    auto &indirectHeap = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+    indirectHeap.getSpace(sizeof(INTERFACE_DESCRIPTOR_DATA));
+
+    HardwareCommandsHelper<FamilyType>::sendInterfaceDescriptorData(
+        indirectHeap, 0, 0x1000, 64, 32, 0x40, 0x80, 0, 4, kernel, 0, pDevice->getPreemptionMode(), nullptr, pDevice->getHardwareInfo());
+    EXPECT_FALSE(kernel.getInterfaceDescriptorTemplate().valid);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenMediaInterfaceDescriptorIsCreatedThenOnlyRequiredSpaceInCommandStreamIsAllocated) {
     CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
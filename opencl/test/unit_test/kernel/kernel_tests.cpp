@@ -44,6 +44,7 @@
 #include "test.h"
 
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 using namespace DeviceHostQueue;
@@ -3256,3 +3257,32 @@ TEST(ArgTypeTraits, GivenDefaultInitializedArgTypeMetadataThenAddressSpaceIsGlob
     ArgTypeTraits metadata;
     EXPECT_EQ(NEO::KernelArgMetadata::AddrGlobal, metadata.addressQualifier);
 }
+
+TEST(InterfaceDescriptorTemplateTest, givenTemplateUpdatedWithDifferentKeysFromManyThreadsWhenCopyingItOutThenDescriptorMatchesItsKey) {
+    InterfaceDescriptorTemplate interfaceDescriptorTemplate;
+
+    auto dispatch = [&interfaceDescriptorTemplate](uint8_t pattern, bool *torn) {
+        InterfaceDescriptorTemplate::Key key;
+        key.sizeCrossThreadData = pattern;
+        uint8_t encoded[InterfaceDescriptorTemplate::maxSize];
+        memset(encoded, pattern, sizeof(encoded));
+
+        for (int i = 0; i < 1000; i++) {
+            uint8_t copied[InterfaceDescriptorTemplate::maxSize] = {};
+            if (interfaceDescriptorTemplate.copyTo(key, copied, sizeof(copied))) {
+                *torn |= (0 != memcmp(encoded, copied, sizeof(copied)));
+            } else {
+                interfaceDescriptorTemplate.update(key, encoded, sizeof(encoded));
+            }
+        }
+    };
+
+    bool torn[2] = {false, false};
+    std::thread first(dispatch, 0x11, &torn[0]);
+    std::thread second(dispatch, 0x22, &torn[1]);
+    first.join();
+    second.join();
+
+    EXPECT_FALSE(torn[0]);
+    EXPECT_FALSE(torn[1]);
+}
@@ -155,6 +155,46 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenBufferWithNotDefaultRootDeviceIndexAndBc
     EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
 }
 
+HWTEST_TEMPLATED_F(BcsBufferTests, givenMultipleMemoryTransfersWhenBlittingMemoryToAllocationsThenAllTransfersAreSubmittedInOneBlitBuffer) {
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getDevice().getEngine(aub_stream::ENGINE_BCS, false, false).commandStreamReceiver);
+    auto memoryManager = device->getMemoryManager();
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    auto firstAllocation = memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::KERNEL_ISA, device->getDeviceBitfield()});
+    auto secondAllocation = memoryManager->allocateGraphicsMemoryWithProperties({rootDeviceIndex, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::CONSTANT_SURFACE, device->getDeviceBitfield()});
+
+    uint8_t isa[64] = {};
+    uint8_t constants[32] = {};
+    MemoryTransfers transfers;
+    transfers.push_back({firstAllocation, 0u, isa, sizeof(isa), true});
+    transfers.push_back({firstAllocation, sizeof(isa), isa, sizeof(isa), true});
+    transfers.push_back({secondAllocation, 16u, constants, sizeof(constants), true});
+
+    auto initialTaskCount = bcsCsr->peekTaskCount();
+    EXPECT_EQ(BlitOperationResult::Success, BlitHelper::blitMemoryToAllocations(device->getDevice(), transfers));
+    EXPECT_EQ(1u, bcsCsr->blitBufferCalled);
+    EXPECT_EQ(initialTaskCount + 1, bcsCsr->peekTaskCount());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(bcsCsr->commandStream);
+    auto blitCommands = findAll<typename FamilyType::XY_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    EXPECT_EQ(transfers.size(), blitCommands.size());
+
+    memoryManager->freeGraphicsMemory(firstAllocation);
+    memoryManager->freeGraphicsMemory(secondAllocation);
+}
+
+HWTEST_TEMPLATED_F(BcsBufferTests, givenBlitterNotSupportedWhenBlittingMemoryToAllocationsThenUnsupportedIsReturned) {
+    device->getRootDeviceEnvironment().getMutableHardwareInfo()->capabilityTable.blitterOperationsSupported = false;
+    auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(bcsMockContext->bcsCsr.get());
+
+    uint8_t isa[64] = {};
+    MemoryTransfers transfers;
+    transfers.push_back({nullptr, 0u, isa, sizeof(isa), true});
+
+    EXPECT_EQ(BlitOperationResult::Unsupported, BlitHelper::blitMemoryToAllocations(device->getDevice(), transfers));
+    EXPECT_EQ(0u, bcsCsr->blitBufferCalled);
+}
+
 HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenEnqueueBufferOperationIsCalledThenUseBcsCsr) {
     DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
     auto bcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(commandQueue->getBcsCommandStreamReceiver());
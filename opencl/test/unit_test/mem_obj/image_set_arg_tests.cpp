@@ -12,6 +12,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/surface.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/mocks/mock_graphics_allocation.h"
 
 #include "opencl/source/helpers/surface_formats.h"
@@ -1153,3 +1154,58 @@ HWTEST_F(ImageSetArgTest, givenMediaCompressedResourceSurfaceModeIsNone) {
 
     EXPECT_EQ(surfaceState.getAuxiliarySurfaceMode(), AUXILIARY_SURFACE_MODE::AUXILIARY_SURFACE_MODE_AUX_NONE);
 }
+
+HWTEST_F(ImageSetArgTest, givenTwoImagesWithSameLayoutWhenSettingImageArgThenSurfaceStateTemplateIsReusedAndOnlyBaseAddressIsPatched) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    auto &surfaceStateCache = context->getImageSurfaceStateCache();
+    EXPECT_EQ(0u, surfaceStateCache.getNumEntries());
+
+    std::unique_ptr<Image> secondImage(Image3dHelper<>::create(context));
+    auto secondAllocation = secondImage->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+
+    auto firstSurfaceState = FamilyType::cmdInitRenderSurfaceState;
+    auto secondSurfaceState = FamilyType::cmdInitRenderSurfaceState;
+
+    srcImage->setImageArg(&firstSurfaceState, false, 0, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(1u, surfaceStateCache.getNumEntries());
+
+    secondImage->setImageArg(&secondSurfaceState, false, 0, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(1u, surfaceStateCache.getNumEntries());
+
+    EXPECT_EQ(srcAllocation->getGpuAddress(), firstSurfaceState.getSurfaceBaseAddress());
+    EXPECT_EQ(secondAllocation->getGpuAddress(), secondSurfaceState.getSurfaceBaseAddress());
+
+    secondSurfaceState.setSurfaceBaseAddress(firstSurfaceState.getSurfaceBaseAddress());
+    EXPECT_EQ(0, memcmp(&firstSurfaceState, &secondSurfaceState, sizeof(RENDER_SURFACE_STATE)));
+}
+
+HWTEST_F(ImageSetArgTest, givenDifferentMipLevelWhenSettingImageArgThenNewSurfaceStateTemplateIsStored) {
+    auto &surfaceStateCache = context->getImageSurfaceStateCache();
+
+    auto surfaceState = FamilyType::cmdInitRenderSurfaceState;
+
+    srcImage->setImageArg(&surfaceState, false, 0, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(0u, surfaceState.getSurfaceMinLod());
+
+    srcImage->setImageArg(&surfaceState, false, 1, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(1u, surfaceState.getSurfaceMinLod());
+    EXPECT_EQ(2u, surfaceStateCache.getNumEntries());
+}
+
+HWTEST_F(ImageSetArgTest, givenRenderCompressedImageWhenSettingImageArgThenSurfaceStateTemplateIsNotStored) {
+    auto surfaceState = FamilyType::cmdInitRenderSurfaceState;
+    srcAllocation->getDefaultGmm()->isRenderCompressed = true;
+
+    srcImage->setImageArg(&surfaceState, false, 0, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(0u, context->getImageSurfaceStateCache().getNumEntries());
+}
+
+HWTEST_F(ImageSetArgTest, givenImageSurfaceStateTemplatesDisabledWhenSettingImageArgThenSurfaceStateTemplateIsNotStored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableImageSurfaceStateTemplates.set(0);
+    auto surfaceState = FamilyType::cmdInitRenderSurfaceState;
+
+    srcImage->setImageArg(&surfaceState, false, 0, pClDevice->getRootDeviceIndex());
+    EXPECT_EQ(srcAllocation->getGpuAddress(), surfaceState.getSurfaceBaseAddress());
+    EXPECT_EQ(0u, context->getImageSurfaceStateCache().getNumEntries());
+}
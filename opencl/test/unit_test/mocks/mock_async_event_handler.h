@@ -26,6 +26,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
     using AsyncEventsHandler::openThread;
+    using AsyncEventsHandler::submittedEvents;
     using AsyncEventsHandler::thread;
 
     ~MockHandler() override {
@@ -59,7 +60,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && submittedEvents.empty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -61,6 +61,9 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
         registerPollCalled = true;
         AUBCommandStreamReceiver::AubFileStream::registerPoll(registerOffset, mask, value, pollNotEqual, timeoutAction);
     }
+    void invalidateDumpedMemory(uint64_t physAddress, size_t size) override {
+        invalidatedDumpedMemorySize += size;
+    }
     uint32_t openCalledCnt = 0;
     std::string fileName = "";
     bool closeCalled = false;
@@ -79,6 +82,7 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
     size_t sizeCapturedFromExpectMemory = 0;
     uint32_t addressSpaceCapturedFromExpectMemory = 0;
     uint32_t compareOperationFromExpectMemory = 0;
+    size_t invalidatedDumpedMemorySize = 0;
 };
 
 struct GmockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
@@ -90,6 +90,9 @@ class MockCommandQueue : public CommandQueue {
                          const size_t *globalWorkSize, const size_t *localWorkSize,
                          cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override { return CL_SUCCESS; }
 
+    cl_int enqueueKernels(cl_uint numKernels, const cl_ndrange_kernel_desc_intel *kernelDescs,
+                          cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override { return CL_SUCCESS; }
+
     cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList,
                                       cl_event *event) override { return CL_SUCCESS; }
 
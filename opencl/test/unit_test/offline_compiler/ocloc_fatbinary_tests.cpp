@@ -360,4 +360,31 @@ TEST_F(OclocFatBinaryGetTargetPlatformsForFatbinary, GivenGenClosedRangeWhenAnyO
     got = NEO::getTargetPlatformsForFatbinary(genName + "-gen2", oclocArgHelperWithoutInput.get());
     EXPECT_TRUE(got.empty());
 }
+
+TEST(OclocFatBinaryParseJobsCount, GivenJobsArgThenReturnRequestedNumberOfConcurrentBuilds) {
+    size_t jobsCount = 0;
+    EXPECT_TRUE(NEO::parseFatBinaryJobsCount("4", jobsCount));
+    EXPECT_EQ(4u, jobsCount);
+
+    jobsCount = 0;
+    EXPECT_TRUE(NEO::parseFatBinaryJobsCount("0", jobsCount));
+    EXPECT_LE(1u, jobsCount);
+
+    jobsCount = 7;
+    EXPECT_FALSE(NEO::parseFatBinaryJobsCount("", jobsCount));
+    EXPECT_FALSE(NEO::parseFatBinaryJobsCount("-2", jobsCount));
+    EXPECT_FALSE(NEO::parseFatBinaryJobsCount("four", jobsCount));
+    EXPECT_EQ(7u, jobsCount);
+}
+
+TEST(OclocFatBinaryParseJobsCount, GivenJobsArgOutOfRangeThenReturnFalse) {
+    size_t jobsCount = 7;
+    EXPECT_TRUE(NEO::parseFatBinaryJobsCount(std::to_string(NEO::maxFatBinaryJobsCount), jobsCount));
+    EXPECT_EQ(NEO::maxFatBinaryJobsCount, jobsCount);
+
+    jobsCount = 7;
+    EXPECT_FALSE(NEO::parseFatBinaryJobsCount(std::to_string(NEO::maxFatBinaryJobsCount + 1), jobsCount));
+    EXPECT_FALSE(NEO::parseFatBinaryJobsCount("99999999999999999999999999", jobsCount));
+    EXPECT_EQ(7u, jobsCount);
+}
 } // namespace NEO
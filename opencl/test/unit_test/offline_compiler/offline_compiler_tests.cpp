@@ -931,6 +931,57 @@ TEST(OfflineCompilerTest, givenBinaryInputThenDontTruncateSourceAtFirstZero) {
     EXPECT_LT(0U, mockOfflineCompiler->sourceCode.size());
 }
 
+TEST(OfflineCompilerTest, givenCompilersForSameSourceAndOptionsWhenOclVersionDiffersThenFrontendCannotBeShared) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler first;
+    MockOfflineCompiler second;
+    ASSERT_EQ(SUCCESS, first.initialize(argv.size(), argv));
+    ASSERT_EQ(SUCCESS, second.initialize(argv.size(), argv));
+    EXPECT_TRUE(first.canShareFrontendWith(second));
+
+    second.hwInfo.capabilityTable.clVersionSupport = first.hwInfo.capabilityTable.clVersionSupport + 1;
+    EXPECT_FALSE(first.canShareFrontendWith(second));
+    EXPECT_FALSE(second.canShareFrontendWith(first));
+}
+
+TEST(OfflineCompilerTest, givenFrontendSourceWithoutIntermediateRepresentationWhenUsingItThenFalseIsReturnedAndOwnSourceIsKept) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-q",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler frontendSource;
+    MockOfflineCompiler backendOnly;
+    ASSERT_EQ(SUCCESS, frontendSource.initialize(argv.size(), argv));
+    ASSERT_EQ(SUCCESS, backendOnly.initialize(argv.size(), argv));
+    auto originalSource = backendOnly.sourceCode;
+
+    EXPECT_FALSE(backendOnly.useIntermediateRepresentationFrom(frontendSource));
+    EXPECT_EQ(originalSource, backendOnly.sourceCode);
+    EXPECT_FALSE(backendOnly.inputFileSpirV);
+    EXPECT_FALSE(backendOnly.inputFileLlvm);
+
+    const char ir[] = {1, 2, 0, 4};
+    frontendSource.irBinary = new char[sizeof(ir)];
+    memcpy(frontendSource.irBinary, ir, sizeof(ir));
+    frontendSource.irBinarySize = sizeof(ir);
+    frontendSource.isSpirV = true;
+    EXPECT_TRUE(backendOnly.useIntermediateRepresentationFrom(frontendSource));
+    EXPECT_EQ(std::string(ir, sizeof(ir)), backendOnly.sourceCode);
+    EXPECT_TRUE(backendOnly.inputFileSpirV);
+    EXPECT_FALSE(backendOnly.inputFileLlvm);
+}
+
 TEST(OfflineCompilerTest, givenSpirvInputFileWhenCmdLineHasOptionsThenCorrectOptionsArePassedToCompiler) {
     char data[] = {1, 2, 3, 4, 5, 6, 7, 8};
     MockCompilerDebugVars igcDebugVars(gEnvironment->igcDebugVars);
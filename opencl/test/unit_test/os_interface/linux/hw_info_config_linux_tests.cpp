@@ -7,6 +7,7 @@
 
 #include "opencl/test/unit_test/os_interface/linux/hw_info_config_linux_tests.h"
 
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
@@ -14,6 +15,7 @@
 
 #include "opencl/extensions/public/cl_ext_private.h"
 
+#include <cstdio>
 #include <cstring>
 
 namespace NEO {
@@ -530,6 +532,127 @@ TEST_F(HwInfoConfigTestLinuxDummy, givenFailingGttSizeIoctlWhenInitializingHwInf
     EXPECT_EQ(pInHwInfo.capabilityTable.gpuAddressSpace, outHwInfo.capabilityTable.gpuAddressSpace);
 }
 
+TEST_F(HwInfoConfigTestLinuxDummy, givenCapsSnapshotDirectorySetWhenHwInfoIsConfiguredThenRawCapsAreStoredAndReusedAfterLoad) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DrmCapsSnapshotDirectory.set(".");
+    DrmCapsSnapshotCache cache(".", 0, 0, "");
+    std::remove(cache.getFileName().c_str());
+
+    EXPECT_FALSE(drm->loadCapsSnapshot());
+    EXPECT_FALSE(drm->isCapsSnapshotLoaded());
+
+    drm->storedGTTSize = maxNBitValue(40) + 1;
+    int ret = hwConfig.configureHwInfo(&pInHwInfo, &outHwInfo, osInterface);
+    EXPECT_EQ(0, ret);
+    auto euCount = outHwInfo.gtSystemInfo.EUCount;
+    auto subSliceCount = outHwInfo.gtSystemInfo.SubSliceCount;
+    EXPECT_TRUE(drm->isPreemptionSupported());
+    EXPECT_TRUE(drm->areNonPersistentContextsSupported());
+    EXPECT_TRUE(fileExists(cache.getFileName()));
+
+    EXPECT_TRUE(drm->loadCapsSnapshot());
+    EXPECT_TRUE(drm->isCapsSnapshotLoaded());
+
+    drm->StoredEUVal = euCount * 2;
+    drm->StoredSSVal = subSliceCount * 2;
+    drm->storedGTTSize = maxNBitValue(47) + 1;
+    drm->failRetTopology = true;
+    drm->StoredPreemptionSupport = 0;
+    drm->StoredPersistentContextsSupport = 0;
+    drm->StoredRetValForGetSSEU = -1;
+    auto ioctlCallsCount = drm->ioctlCallsCount;
+    ret = hwConfig.configureHwInfo(&pInHwInfo, &outHwInfo, osInterface);
+    EXPECT_EQ(0, ret);
+    // only device and revision IDs are queried, snapshot is keyed with them
+    EXPECT_EQ(ioctlCallsCount + 2u, drm->ioctlCallsCount);
+    EXPECT_EQ(euCount, outHwInfo.gtSystemInfo.EUCount);
+    EXPECT_EQ(subSliceCount, outHwInfo.gtSystemInfo.SubSliceCount);
+    EXPECT_EQ(maxNBitValue(40), outHwInfo.capabilityTable.gpuAddressSpace);
+    EXPECT_TRUE(drm->isPreemptionSupported());
+    EXPECT_TRUE(drm->areNonPersistentContextsSupported());
+
+    std::remove(cache.getFileName().c_str());
+}
+
+TEST_F(HwInfoConfigTestLinuxDummy, givenTopologyQueryFailingWhenCapsSnapshotIsReusedThenEuAndSubsliceTotalsAreTakenFromSnapshot) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DrmCapsSnapshotDirectory.set(".");
+    DrmCapsSnapshotCache cache(".", 0, 0, "");
+    std::remove(cache.getFileName().c_str());
+
+    drm->failRetTopology = true;
+    drm->StoredEUVal = 12;
+    drm->StoredSSVal = 3;
+    int ret = hwConfig.configureHwInfo(&pInHwInfo, &outHwInfo, osInterface);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(12u, outHwInfo.gtSystemInfo.EUCount);
+    EXPECT_EQ(3u, outHwInfo.gtSystemInfo.SubSliceCount);
+
+    EXPECT_TRUE(drm->loadCapsSnapshot());
+    drm->StoredRetValForEUVal = -1;
+    drm->StoredRetValForSSVal = -1;
+    ret = hwConfig.configureHwInfo(&pInHwInfo, &outHwInfo, osInterface);
+    EXPECT_EQ(0, ret);
+    EXPECT_EQ(12u, outHwInfo.gtSystemInfo.EUCount);
+    EXPECT_EQ(3u, outHwInfo.gtSystemInfo.SubSliceCount);
+
+    std::remove(cache.getFileName().c_str());
+}
+
+TEST(DrmCapsSnapshotCacheTest, givenSnapshotStoredForDifferentDeviceWhenLoadingThenSnapshotIsRejected) {
+    DrmCapsSnapshot snapshot = {};
+    snapshot.topologyQueried = 1;
+    snapshot.euCount = 24;
+
+    DrmCapsSnapshotCache storedCache(".", 0x1234, 1, "0000:00:02.0");
+    EXPECT_TRUE(storedCache.store(snapshot));
+
+    DrmCapsSnapshot loadedSnapshot = {};
+    EXPECT_TRUE(storedCache.load(loadedSnapshot));
+    EXPECT_EQ(24, loadedSnapshot.euCount);
+
+    DrmCapsSnapshotCache otherRevisionCache(".", 0x1234, 2, "0000:00:02.0");
+    EXPECT_NE(storedCache.getKey(), otherRevisionCache.getKey());
+    EXPECT_FALSE(otherRevisionCache.load(loadedSnapshot));
+
+    std::remove(storedCache.getFileName().c_str());
+    EXPECT_FALSE(storedCache.load(loadedSnapshot));
+}
+
+TEST(DrmCapsSnapshotCacheTest, givenExistingSnapshotWhenStoringThenFileIsReplacedAndNoTemporaryFileIsLeft) {
+    DrmCapsSnapshot snapshot = {};
+    snapshot.euTotal.queryRet = 0;
+    snapshot.euTotal.value = 24;
+
+    DrmCapsSnapshotCache cache(".", 0x1234, 1, "0000:00:02.0");
+    EXPECT_TRUE(cache.store(snapshot));
+    snapshot.euTotal.value = 48;
+    EXPECT_TRUE(cache.store(snapshot));
+
+    DrmCapsSnapshot loadedSnapshot = {};
+    EXPECT_TRUE(cache.load(loadedSnapshot));
+    EXPECT_EQ(0, loadedSnapshot.euTotal.queryRet);
+    EXPECT_EQ(48, loadedSnapshot.euTotal.value);
+    EXPECT_FALSE(fileExists(cache.getFileName() + "." + std::to_string(getpid()) + ".tmp"));
+
+    std::remove(cache.getFileName().c_str());
+}
+
+TEST(DrmCapsSnapshotCacheTest, givenNotExistingDirectoryWhenStoringThenFailureIsReturnedAndNothingIsWritten) {
+    DrmCapsSnapshot snapshot = {};
+    DrmCapsSnapshotCache cache("./not_existing_drm_caps_dir", 0x1234, 1, "0000:00:02.0");
+    EXPECT_FALSE(cache.store(snapshot));
+    EXPECT_FALSE(fileExists(cache.getFileName()));
+}
+
+TEST(DrmCapsSnapshotCacheTest, givenDifferentKernelOrDriverBuildWhenComputingKeyThenKeysDiffer) {
+    auto key = DrmCapsSnapshotCache::computeKey(0x1234, 1, "0000:00:02.0", "5.4.0", "20.40.0");
+    EXPECT_EQ(key, DrmCapsSnapshotCache::computeKey(0x1234, 1, "0000:00:02.0", "5.4.0", "20.40.0"));
+    EXPECT_NE(key, DrmCapsSnapshotCache::computeKey(0x1234, 1, "0000:00:02.0", "5.8.0", "20.40.0"));
+    EXPECT_NE(key, DrmCapsSnapshotCache::computeKey(0x1234, 1, "0000:00:02.0", "5.4.0", "20.41.0"));
+    EXPECT_NE(key, DrmCapsSnapshotCache::computeKey(0x1234, 1, "0000:03:00.0", "5.4.0", "20.40.0"));
+}
+
 TEST(HwInfoConfigLinuxTest, whenAdjustPlatformForProductFamilyCalledThenDoNothing) {
     HardwareInfo localHwInfo = *defaultHwInfo;
 
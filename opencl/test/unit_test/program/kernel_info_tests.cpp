@@ -6,7 +6,10 @@
  */
 
 #include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "shared/test/unit_test/mocks/ult_device_factory.h"
 
@@ -159,6 +162,58 @@ TEST(KernelInfoTest, givenKernelInfoWhenCreatingKernelAllocationWithInternalIsaT
     device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
 }
 
+TEST(KernelInfoTest, givenSharedIsaHeapEnabledWhenCreatingKernelAllocationsThenKernelsAreSubAllocatedFromOneArena) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedIsaHeap.set(1);
+    KernelInfo kernelInfos[2];
+    auto factory = UltDeviceFactory{1, 0};
+    auto device = factory.rootDevices[0];
+    const size_t heapSize = 0x40;
+    char heaps[2][heapSize];
+
+    for (size_t kernelId = 0; kernelId < 2; kernelId++) {
+        for (size_t i = 0; i < heapSize; i++) {
+            heaps[kernelId][i] = static_cast<char>(kernelId + i);
+        }
+        kernelInfos[kernelId].heapInfo.KernelHeapSize = heapSize;
+        kernelInfos[kernelId].heapInfo.pKernelHeap = heaps[kernelId];
+        EXPECT_TRUE(kernelInfos[kernelId].createKernelAllocation(*device, false));
+    }
+
+    auto isaHeapAllocator = device->getIsaHeapAllocator();
+    ASSERT_NE(nullptr, isaHeapAllocator);
+    EXPECT_EQ(1u, isaHeapAllocator->getArenasCount());
+    EXPECT_EQ(kernelInfos[0].kernelAllocation, kernelInfos[1].kernelAllocation);
+    EXPECT_NE(kernelInfos[0].getIsaOffsetInParentAllocation(), kernelInfos[1].getIsaOffsetInParentAllocation());
+
+    for (size_t kernelId = 0; kernelId < 2; kernelId++) {
+        auto &kernelInfo = kernelInfos[kernelId];
+        EXPECT_EQ(isaHeapAllocator, kernelInfo.isaHeapAllocator);
+        auto isa = ptrOffset(kernelInfo.kernelAllocation->getUnderlyingBuffer(), kernelInfo.getIsaOffsetInParentAllocation());
+        EXPECT_EQ(0, memcmp(isa, heaps[kernelId], heapSize));
+        isaHeapAllocator->free(kernelInfo.kernelAllocation, kernelInfo.getIsaOffsetInParentAllocation());
+        kernelInfo.kernelAllocation = nullptr;
+    }
+}
+
+TEST(KernelInfoTest, givenSharedIsaHeapEnabledWhenCreatingInternalKernelAllocationThenDedicatedAllocationIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSharedIsaHeap.set(1);
+    KernelInfo kernelInfo;
+    auto factory = UltDeviceFactory{1, 0};
+    auto device = factory.rootDevices[0];
+    const size_t heapSize = 0x40;
+    char heap[heapSize];
+    kernelInfo.heapInfo.KernelHeapSize = heapSize;
+    kernelInfo.heapInfo.pKernelHeap = &heap;
+
+    EXPECT_TRUE(kernelInfo.createKernelAllocation(*device, true));
+    EXPECT_EQ(nullptr, kernelInfo.isaHeapAllocator);
+    EXPECT_EQ(0u, kernelInfo.getIsaOffsetInParentAllocation());
+    EXPECT_EQ(0u, device->getIsaHeapAllocator()->getArenasCount());
+    device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(kernelInfo.kernelAllocation);
+}
+
 class MyMemoryManager : public OsAgnosticMemoryManager {
   public:
     using OsAgnosticMemoryManager::OsAgnosticMemoryManager;
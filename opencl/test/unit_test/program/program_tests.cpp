@@ -8,6 +8,7 @@
 #include "opencl/test/unit_test/program/program_tests.h"
 
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
+#include "shared/source/compiler_interface/compiler_build_pool.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
@@ -613,6 +614,127 @@ TEST_F(ProgramFromBinaryTest, givenProgramWhenCleanKernelInfoIsCalledThenKernelA
     EXPECT_EQ(0u, pProgram->getNumKernels());
 }
 
+TEST_F(ProgramFromBinaryTest, givenProgramArtifactsSharingEnabledWhenProgramsAreBuiltFromIdenticalBinaryThenKernelIsaIsSharedUntilLastProgramIsCleaned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableProgramArtifactsSharing.set(1);
+    auto &registry = pContext->getProgramArtifactsRegistry();
+
+    pProgram->build(pProgram->getDevices(), nullptr, true);
+    EXPECT_EQ(1u, registry.getNumEntries());
+    auto kernelAllocation = pProgram->getKernelInfo(static_cast<size_t>(0u), rootDeviceIndex)->getGraphicsAllocation();
+    ASSERT_NE(nullptr, kernelAllocation);
+
+    auto &buildInfo = pProgram->buildInfos[rootDeviceIndex];
+    auto otherProgram = std::make_unique<MockProgram>(pContext, false, pContext->getDevices());
+    otherProgram->options = pProgram->options;
+    otherProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(buildInfo.unpackedDeviceBinary.get(), buildInfo.unpackedDeviceBinarySize);
+    otherProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = buildInfo.unpackedDeviceBinarySize;
+    EXPECT_EQ(CL_SUCCESS, otherProgram->processGenBinary(*pClDevice));
+    EXPECT_EQ(1u, registry.getNumEntries());
+    EXPECT_EQ(kernelAllocation, otherProgram->getKernelInfo(static_cast<size_t>(0u), rootDeviceIndex)->getGraphicsAllocation());
+    EXPECT_EQ(buildInfo.constantSurface, otherProgram->buildInfos[rootDeviceIndex].constantSurface);
+
+    otherProgram.reset();
+    EXPECT_EQ(1u, registry.getNumEntries());
+    EXPECT_EQ(kernelAllocation, pProgram->getKernelInfo(static_cast<size_t>(0u), rootDeviceIndex)->getGraphicsAllocation());
+
+    pProgram->cleanCurrentKernelInfo(rootDeviceIndex);
+    EXPECT_EQ(0u, registry.getNumEntries());
+}
+
+TEST_F(ProgramFromBinaryTest, givenProgramArtifactsSharingEnabledWhenProgramsAreBuiltWithDifferentOptionsThenKernelIsaIsNotShared) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableProgramArtifactsSharing.set(1);
+    auto &registry = pContext->getProgramArtifactsRegistry();
+
+    pProgram->build(pProgram->getDevices(), nullptr, true);
+    auto kernelAllocation = pProgram->getKernelInfo(static_cast<size_t>(0u), rootDeviceIndex)->getGraphicsAllocation();
+
+    auto &buildInfo = pProgram->buildInfos[rootDeviceIndex];
+    auto otherProgram = std::make_unique<MockProgram>(pContext, false, pContext->getDevices());
+    otherProgram->options = pProgram->options + " -cl-fast-relaxed-math";
+    otherProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(buildInfo.unpackedDeviceBinary.get(), buildInfo.unpackedDeviceBinarySize);
+    otherProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = buildInfo.unpackedDeviceBinarySize;
+    EXPECT_EQ(CL_SUCCESS, otherProgram->processGenBinary(*pClDevice));
+    EXPECT_EQ(2u, registry.getNumEntries());
+    EXPECT_NE(kernelAllocation, otherProgram->getKernelInfo(static_cast<size_t>(0u), rootDeviceIndex)->getGraphicsAllocation());
+}
+
+TEST_F(ProgramFromBinaryTest, givenProgramArtifactsSharingDisabledByDefaultWhenProgramIsBuiltThenArtifactsAreNotRegistered) {
+    pProgram->build(pProgram->getDevices(), nullptr, true);
+    EXPECT_EQ(0u, pContext->getProgramArtifactsRegistry().getNumEntries());
+    EXPECT_EQ(nullptr, pProgram->buildInfos[rootDeviceIndex].sharedArtifacts);
+}
+
+TEST(ProgramArtifactsRegistryTest, givenRegisteredArtifactsWhenAcquiringAndReleasingThenEntryIsRemovedWithLastReference) {
+    ProgramArtifactsRegistry registry;
+    const uint8_t binary[] = {1, 2, 3, 4};
+    auto key = ProgramArtifactsRegistry::createKey(0u, binary, "");
+    EXPECT_EQ(nullptr, registry.acquire(key, binary, "", 1u));
+
+    MockGraphicsAllocation constantSurface;
+    MockGraphicsAllocation isa;
+    KernelInfo kernelInfo;
+    kernelInfo.kernelAllocation = &isa;
+    kernelInfo.kernelAllocationOffset = 0x40;
+    std::vector<KernelInfo *> kernelInfos = {&kernelInfo};
+
+    auto artifacts = registry.registerArtifacts(key, binary, "", &constantSurface, kernelInfos);
+    ASSERT_NE(nullptr, artifacts);
+    EXPECT_EQ(nullptr, registry.registerArtifacts(key, binary, "", &constantSurface, kernelInfos));
+    EXPECT_EQ(&constantSurface, artifacts->constantSurface);
+    ASSERT_EQ(1u, artifacts->kernelIsas.size());
+    EXPECT_EQ(&isa, artifacts->kernelIsas[0].allocation);
+    EXPECT_EQ(0x40u, artifacts->kernelIsas[0].offset);
+    EXPECT_EQ(nullptr, artifacts->kernelIsas[0].isaHeapAllocator);
+
+    EXPECT_EQ(nullptr, registry.acquire(key, binary, "", 2u));
+    EXPECT_EQ(artifacts, registry.acquire(key, binary, "", 1u));
+    EXPECT_EQ(2u, artifacts->refCount);
+
+    EXPECT_FALSE(registry.release(artifacts));
+    EXPECT_EQ(1u, registry.getNumEntries());
+    EXPECT_TRUE(registry.release(artifacts));
+    EXPECT_EQ(0u, registry.getNumEntries());
+    kernelInfo.kernelAllocation = nullptr;
+}
+
+TEST(ProgramArtifactsRegistryTest, givenKeyOfRegisteredArtifactsWhenAcquiringWithDifferentBinaryOrOptionsThenArtifactsAreNotReturned) {
+    ProgramArtifactsRegistry registry;
+    const uint8_t binary[] = {1, 2, 3, 4};
+    const uint8_t otherBinary[] = {1, 2, 3, 5};
+    const uint8_t longerBinary[] = {1, 2, 3, 4, 5};
+    auto key = ProgramArtifactsRegistry::createKey(0u, binary, "-cl-opt-disable");
+
+    MockGraphicsAllocation isa;
+    KernelInfo kernelInfo;
+    kernelInfo.kernelAllocation = &isa;
+    std::vector<KernelInfo *> kernelInfos = {&kernelInfo};
+    auto artifacts = registry.registerArtifacts(key, binary, "-cl-opt-disable", nullptr, kernelInfos);
+    ASSERT_NE(nullptr, artifacts);
+
+    // key collision - same key computed for different input
+    EXPECT_EQ(nullptr, registry.acquire(key, otherBinary, "-cl-opt-disable", 1u));
+    EXPECT_EQ(nullptr, registry.acquire(key, longerBinary, "-cl-opt-disable", 1u));
+    EXPECT_EQ(nullptr, registry.acquire(key, binary, "", 1u));
+    EXPECT_EQ(1u, artifacts->refCount);
+
+    EXPECT_EQ(artifacts, registry.acquire(key, binary, "-cl-opt-disable", 1u));
+    EXPECT_FALSE(registry.release(artifacts));
+    EXPECT_TRUE(registry.release(artifacts));
+    kernelInfo.kernelAllocation = nullptr;
+}
+
+TEST(ProgramArtifactsRegistryTest, whenCreatingKeysThenBinaryOptionsAndRootDeviceIndexAreTakenIntoAccount) {
+    const uint8_t binary[] = {1, 2, 3, 4};
+    const uint8_t otherBinary[] = {1, 2, 3, 5};
+    auto key = ProgramArtifactsRegistry::createKey(0u, binary, "-cl-opt-disable");
+    EXPECT_TRUE(key == ProgramArtifactsRegistry::createKey(0u, binary, "-cl-opt-disable"));
+    EXPECT_FALSE(key == ProgramArtifactsRegistry::createKey(0u, otherBinary, "-cl-opt-disable"));
+    EXPECT_FALSE(key == ProgramArtifactsRegistry::createKey(0u, binary, ""));
+    EXPECT_FALSE(key == ProgramArtifactsRegistry::createKey(1u, binary, "-cl-opt-disable"));
+}
+
 HWTEST_F(ProgramFromBinaryTest, givenProgramWhenCleanCurrentKernelInfoIsCalledButGpuIsNotYetDoneThenKernelAllocationIsPutOnDeferredFreeListAndCsrRegistersCacheFlush) {
     auto &csr = pDevice->getGpgpuCommandStreamReceiver();
     EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
@@ -808,6 +930,26 @@ TEST_F(ProgramFromSourceTest, WhenBuildingProgramWithOpenClC20ThenExtraExtension
     EXPECT_EQ(1, MockProgram::initInternalOptionsCalled);
 }
 
+TEST_F(ProgramFromSourceTest, givenEnableCompilerBuildPoolWhenBuildingProgramForSingleDeviceThenSourceIsCompiledByBuildPoolOnCallingThread) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCompilerBuildPool.set(1);
+    DebugManager.flags.CompilerBuildPoolThreads.set(1);
+
+    auto cip = new MockCompilerInterfaceCaptureBuildOptions();
+    auto pClDevice = pContext->getDevice(0);
+    pClDevice->getExecutionEnvironment()->rootDeviceEnvironments[pClDevice->getRootDeviceIndex()]->compilerInterface.reset(cip);
+    auto pProgram = std::make_unique<SucceedingGenBinaryProgram>(toClDeviceVector(*pClDevice));
+    pProgram->sourceCode = "__kernel mock() {}";
+    pProgram->createdFrom = Program::CreatedFrom::SOURCE;
+
+    retVal = pProgram->build(pProgram->getDevices(), CompilerOptions::fastRelaxedMath.data(), false);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto buildPool = pClDevice->getExecutionEnvironment()->getCompilerBuildPool();
+    EXPECT_EQ(0U, buildPool->getNumQueuedJobs());
+    EXPECT_EQ(0U, buildPool->getThreadsCount());
+    EXPECT_THAT(cip->buildOptions, testing::HasSubstr(CompilerOptions::fastRelaxedMath.str()));
+}
+
 TEST_F(ProgramFromSourceTest, WhenBuildingProgramWithOpenClC30ThenFeaturesAreAdded) {
     auto cip = new MockCompilerInterfaceCaptureBuildOptions();
     auto pClDevice = pContext->getDevice(0);
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/utilities/binary_api_tracer.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <thread>
+
+using namespace NEO;
+
+class MockBinaryApiTracer : public BinaryApiTracer {
+  public:
+    using BinaryApiTracer::buffers;
+
+    MockBinaryApiTracer() : BinaryApiTracer("", false) {}
+
+    void writeToFile(const void *data, size_t size) override {
+        auto bytes = reinterpret_cast<const uint8_t *>(data);
+        writtenData.insert(writtenData.end(), bytes, bytes + size);
+    }
+
+    std::vector<BinaryApiTraceRecord> getWrittenRecords(BinaryApiTraceRecordType type) const {
+        std::vector<BinaryApiTraceRecord> records;
+        for (size_t offset = sizeof(BinaryApiTraceFileHeader); offset + sizeof(BinaryApiTraceRecord) <= writtenData.size(); offset += sizeof(BinaryApiTraceRecord)) {
+            BinaryApiTraceRecord record;
+            memcpy(&record, writtenData.data() + offset, sizeof(record));
+            if (record.type == static_cast<uint32_t>(type)) {
+                records.push_back(record);
+            }
+        }
+        return records;
+    }
+
+    std::vector<uint8_t> writtenData;
+};
+
+TEST(BinaryApiTracerTest, givenRecordedApiCallsWhenFlushingThenHeaderNamesAndCallsAreWritten) {
+    MockBinaryApiTracer tracer;
+    auto functionId = BinaryApiTracer::registerFunction("clBinaryApiTracerTestFunction");
+
+    tracer.recordApiCall(functionId, 100, 200, -5);
+    tracer.flush();
+
+    ASSERT_GE(tracer.writtenData.size(), sizeof(BinaryApiTraceFileHeader));
+    BinaryApiTraceFileHeader header;
+    memcpy(&header, tracer.writtenData.data(), sizeof(header));
+    EXPECT_EQ(BinaryApiTraceFileHeader::magicValue, header.magic);
+    EXPECT_EQ(sizeof(BinaryApiTraceRecord), header.recordSize);
+    EXPECT_EQ(0u, (tracer.writtenData.size() - sizeof(header)) % sizeof(BinaryApiTraceRecord));
+
+    auto nameRecords = tracer.getWrittenRecords(BinaryApiTraceRecordType::FunctionName);
+    ASSERT_LT(functionId, nameRecords.size());
+    EXPECT_EQ(functionId, nameRecords[functionId].functionId);
+    EXPECT_STREQ("clBinaryApiTracerTestFunction", nameRecords[functionId].functionName);
+
+    auto callRecords = tracer.getWrittenRecords(BinaryApiTraceRecordType::ApiCall);
+    ASSERT_EQ(1u, callRecords.size());
+    EXPECT_EQ(functionId, callRecords[0].functionId);
+    EXPECT_EQ(100u, callRecords[0].apiCall.startTimestamp);
+    EXPECT_EQ(200u, callRecords[0].apiCall.endTimestamp);
+    EXPECT_EQ(-5, callRecords[0].apiCall.retVal);
+
+    auto writtenSize = tracer.writtenData.size();
+    tracer.flush();
+    EXPECT_EQ(writtenSize, tracer.writtenData.size());
+}
+
+TEST(BinaryApiTracerTest, givenFullThreadBufferWhenRecordingApiCallThenRecordIsDroppedAndReportedOnFlush) {
+    MockBinaryApiTracer tracer;
+    auto functionId = BinaryApiTracer::registerFunction("clBinaryApiTracerDropTestFunction");
+
+    for (size_t i = 0; i < BinaryApiTraceBuffer::capacity + 3; i++) {
+        tracer.recordApiCall(functionId, i, i + 1, 0);
+    }
+    tracer.flush();
+
+    EXPECT_EQ(BinaryApiTraceBuffer::capacity, tracer.getWrittenRecords(BinaryApiTraceRecordType::ApiCall).size());
+    auto droppedRecords = tracer.getWrittenRecords(BinaryApiTraceRecordType::DroppedRecords);
+    ASSERT_EQ(1u, droppedRecords.size());
+    EXPECT_EQ(3u, droppedRecords[0].droppedCount);
+
+    tracer.recordApiCall(functionId, 0, 1, 0);
+    tracer.flush();
+    EXPECT_EQ(BinaryApiTraceBuffer::capacity + 1, tracer.getWrittenRecords(BinaryApiTraceRecordType::ApiCall).size());
+}
+
+TEST(BinaryApiTracerTest, givenThreadThatRecordedApiCallsWhenItExitsThenItsBufferIsReleasedAfterNextFlush) {
+    MockBinaryApiTracer tracer;
+    auto functionId = BinaryApiTracer::registerFunction("clBinaryApiTracerThreadExitTestFunction");
+
+    std::thread apiThread([&]() {
+        tracer.recordApiCall(functionId, 1, 2, 0);
+    });
+    apiThread.join();
+    EXPECT_EQ(1u, tracer.buffers.size());
+
+    tracer.flush();
+    EXPECT_EQ(0u, tracer.buffers.size());
+    EXPECT_EQ(1u, tracer.getWrittenRecords(BinaryApiTraceRecordType::ApiCall).size());
+}
+
+TEST(BinaryApiTracerTest, givenArgsStashedForFunctionWhenTakingThemForSameFunctionThenLeadingArgsAreReturnedOnce) {
+    int intArg = 7;
+    void *pointerArg = &intArg;
+    struct {
+        int a;
+    } structArg = {3};
+    size_t sizeArg = 16;
+
+    auto &callArgs = BinaryApiTracer::getThreadCallArgs();
+    callArgs.reset("clBinaryApiTracerArgsTestFunction");
+    callArgs.stash(&intArg, &pointerArg, &structArg, &sizeArg);
+
+    uint64_t args[BinaryApiTraceRecord::maxArgs] = {};
+    BinaryApiTracer::takeCallArgs("clBinaryApiTracerArgsTestFunction", args);
+    EXPECT_EQ(7u, args[0]);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointerArg), args[1]);
+    EXPECT_EQ(0u, args[2]);
+
+    uint64_t argsTakenAgain[BinaryApiTraceRecord::maxArgs] = {};
+    BinaryApiTracer::takeCallArgs("clBinaryApiTracerArgsTestFunction", argsTakenAgain);
+    EXPECT_EQ(0u, argsTakenAgain[0]);
+    EXPECT_EQ(0u, argsTakenAgain[1]);
+}
+
+TEST(BinaryApiTracerTest, givenArgsStashedForOtherFunctionWhenTakingThemThenArgsStayZeroed) {
+    int intArg = 7;
+    auto &callArgs = BinaryApiTracer::getThreadCallArgs();
+    callArgs.reset("clBinaryApiTracerOtherFunction");
+    callArgs.stash(&intArg);
+
+    uint64_t args[BinaryApiTraceRecord::maxArgs] = {};
+    BinaryApiTracer::takeCallArgs("clBinaryApiTracerArgsTestFunction", args);
+    EXPECT_EQ(0u, args[0]);
+}
+
+TEST(BinaryApiTracerTest, givenApiCallWithArgsWhenFlushingThenArgsAreWrittenInRecord) {
+    MockBinaryApiTracer tracer;
+    auto functionId = BinaryApiTracer::registerFunction("clBinaryApiTracerArgsRecordTestFunction");
+
+    uint64_t args[BinaryApiTraceRecord::maxArgs] = {1, 2, 3};
+    tracer.recordApiCall(functionId, 1, 2, 0, args);
+    tracer.flush();
+
+    auto callRecords = tracer.getWrittenRecords(BinaryApiTraceRecordType::ApiCall);
+    ASSERT_EQ(1u, callRecords.size());
+    EXPECT_EQ(1u, callRecords[0].apiCall.args[0]);
+    EXPECT_EQ(2u, callRecords[0].apiCall.args[1]);
+    EXPECT_EQ(3u, callRecords[0].apiCall.args[2]);
+}
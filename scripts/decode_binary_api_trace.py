@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2020 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+import sys
+import argparse
+import json
+import struct
+
+HEADER_FORMAT = '<IIII'
+HEADER_MAGIC = 0x52544142
+SUPPORTED_VERSION = 1
+
+RECORD_FUNCTION_NAME = 1
+RECORD_API_CALL = 2
+RECORD_DROPPED_RECORDS = 3
+
+
+def decode(data):
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if len(data) < header_size:
+        raise ValueError('trace file is too small')
+    magic, version, record_size, timestamp_unit_ns = struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != HEADER_MAGIC:
+        raise ValueError('not a binary API trace file')
+    if version != SUPPORTED_VERSION:
+        raise ValueError('unsupported trace version %d' % version)
+
+    function_names = {}
+    events = []
+    dropped = 0
+    for offset in range(header_size, len(data) - record_size + 1, record_size):
+        record_type, function_id = struct.unpack_from('<II', data, offset)
+        payload = offset + 8
+        if record_type == RECORD_FUNCTION_NAME:
+            name = data[payload:offset + record_size].split(b'\0', 1)[0]
+            function_names[function_id] = name.decode('ascii', 'replace')
+        elif record_type == RECORD_API_CALL:
+            thread_id, start, end, ret_val, arg0, arg1, arg2 = struct.unpack_from('<QQQqQQQ', data, payload)
+            events.append({
+                'name': function_names.get(function_id, 'function_%d' % function_id),
+                'ph': 'X',
+                'pid': 0,
+                'tid': thread_id,
+                'ts': start * timestamp_unit_ns / 1000.0,
+                'dur': (end - start) * timestamp_unit_ns / 1000.0,
+                'args': {'retVal': ret_val, 'arg0': hex(arg0), 'arg1': hex(arg1), 'arg2': hex(arg2)}
+            })
+        elif record_type == RECORD_DROPPED_RECORDS:
+            dropped += struct.unpack_from('<Q', data, payload)[0]
+    return events, dropped
+
+
+def main(args):
+    parser = argparse.ArgumentParser(description='Converts binary OpenCL API trace (BinaryApiTraceFile) into Chrome trace event JSON')
+    parser.add_argument('trace', help='binary trace file')
+    parser.add_argument('-o', '--output', help='output JSON file, stdout when omitted')
+    options = parser.parse_args(args)
+
+    with open(options.trace, 'rb') as trace_file:
+        events, dropped = decode(trace_file.read())
+
+    output = json.dumps({'traceEvents': events, 'otherData': {'droppedRecords': dropped}})
+    if options.output:
+        with open(options.output, 'w') as output_file:
+            output_file.write(output)
+    else:
+        print(output)
+
+    if dropped > 0:
+        print('warning: %d records were dropped while tracing' % dropped, file=sys.stderr)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -10,6 +10,7 @@
 #include <cctype>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -47,6 +48,7 @@ class OclocArgHelper {
     bool hasOutput = false;
     void moveOutputs();
     MessagePrinter messagePrinter;
+    std::mutex printMutex; // fatbinary targets may be built concurrently
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
@@ -79,10 +81,12 @@ class OclocArgHelper {
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(format, std::forward<Args>(args)...);
     }
 };
@@ -13,13 +13,19 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "compiler_options.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
 
 namespace NEO {
 
@@ -221,9 +227,82 @@ std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef device
     return toProductNames(requestedPlatforms);
 }
 
+bool parseFatBinaryJobsCount(ConstStringRef jobsArg, size_t &jobsCount) {
+    if (jobsArg.empty() || false == std::all_of(jobsArg.begin(), jobsArg.end(), [](char c) { return isdigit(c) != 0; })) {
+        return false;
+    }
+    auto jobsArgStr = jobsArg.str();
+    char *parseEnd = nullptr;
+    errno = 0;
+    auto parsedJobsCount = strtoul(jobsArgStr.c_str(), &parseEnd, 10);
+    if ((errno == ERANGE) || (*parseEnd != '\0') || (parsedJobsCount > maxFatBinaryJobsCount)) {
+        return false;
+    }
+    jobsCount = static_cast<size_t>(parsedJobsCount);
+    if (jobsCount == 0) {
+        jobsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return true;
+}
+
+namespace {
+struct FatBinaryTarget {
+    ConstStringRef platform;
+    std::string name;
+    std::unique_ptr<OfflineCompiler> compiler;
+    int retVal = 0;
+    size_t frontendSourceIndex = 0;
+};
+
+int createTargetCompiler(FatBinaryTarget &target, ConstStringRef platform, std::vector<std::string> &argsCopy, size_t deviceArgIndex, OclocArgHelper *argHelper) {
+    target.platform = platform;
+    argsCopy[deviceArgIndex] = platform.str();
+
+    int retVal = 0;
+    target.compiler.reset(OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper));
+    if (ErrorCode::SUCCESS != retVal) {
+        argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+        return retVal;
+    }
+    target.name = platform.str() + "." + std::to_string(target.compiler->getHardwareInfo().platform.usRevId);
+    return retVal;
+}
+
+void printTargetBuildResult(const FatBinaryTarget &target, const std::vector<std::string> &argsCopy, OclocArgHelper *argHelper) {
+    std::string &buildLog = target.compiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
+
+    if (target.retVal == 0) {
+        if (!target.compiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", target.name.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", target.name.c_str(), target.retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+    }
+}
+
+// Compiler libraries get the same contract as in the driver's CompilerInterface:
+// CIF main and device contexts are created serially (in OfflineCompiler::create on this thread),
+// workers only create translation contexts from their own compiler's device contexts.
+void buildTargetsConcurrently(std::vector<FatBinaryTarget> &targets, const std::vector<size_t> &targetIndices, size_t jobsCount) {
+    auto threadsCount = std::min(jobsCount, targetIndices.size());
+    parallelFor(targetIndices.size(), threadsCount, [&](size_t i) {
+        auto &target = targets[targetIndices[i]];
+        target.retVal = buildWithSafetyGuard(target.compiler.get());
+    });
+}
+} // namespace
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
+    size_t jobsArgIndex = -1;
+    size_t jobsCount = 1;
     std::string inputFileName = "";
     std::string outputFileName = "";
     std::string outputDirectory = "";
@@ -235,6 +314,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            if (false == parseFatBinaryJobsCount(ConstStringRef(args[argIndex + 1]), jobsCount)) {
+                argHelper->printf("Invalid number of jobs : %s\n", args[argIndex + 1].c_str());
+                return INVALID_COMMAND_LINE;
+            }
+            jobsArgIndex = argIndex;
+            ++argIndex;
         } else if ((CompilerOptions::arch32bit == currArg) || (ConstStringRef("-32") == currArg)) {
             pointerSizeInBits = "32";
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
@@ -258,44 +344,81 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return 1;
     }
 
-    NEO::Ar::ArEncoder fatbinary(true);
-
-    for (auto targetPlatform : targetPlatforms) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
+    // -j is consumed here, OfflineCompiler does not know it
+    if (jobsArgIndex != static_cast<size_t>(-1)) {
+        argsCopy.erase(argsCopy.begin() + jobsArgIndex, argsCopy.begin() + jobsArgIndex + 2);
+        if (deviceArgIndex > jobsArgIndex) {
+            deviceArgIndex -= 2;
+        }
+    }
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (ErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+    NEO::Ar::ArEncoder fatbinary(true, true);
+    if (jobsCount == 1) {
+        for (auto targetPlatform : targetPlatforms) {
+            FatBinaryTarget target;
+            auto retVal = createTargetCompiler(target, targetPlatform, argsCopy, deviceArgIndex, argHelper);
+            if (ErrorCode::SUCCESS != retVal) {
+                return retVal;
+            }
+            target.retVal = buildWithSafetyGuard(target.compiler.get());
+            printTargetBuildResult(target, argsCopy, argHelper);
+            if (0 != target.retVal) {
+                return target.retVal;
+            }
+            fatbinary.appendFileEntry(pointerSizeInBits + "." + target.name, target.compiler->getPackedDeviceBinaryOutput());
+        }
+    } else {
+        // all compilers have to outlive the worker pool
+        std::vector<FatBinaryTarget> targets(targetPlatforms.size());
+        for (size_t i = 0; i < targetPlatforms.size(); i++) {
+            auto retVal = createTargetCompiler(targets[i], targetPlatforms[i], argsCopy, deviceArgIndex, argHelper);
+            if (ErrorCode::SUCCESS != retVal) {
+                return retVal;
+            }
         }
 
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
-        if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+        // Targets whose frontend inputs match the first such target reuse its IR and run only the backend
+        std::vector<size_t> frontendTargets;
+        std::vector<size_t> backendOnlyTargets;
+        for (size_t i = 0; i < targets.size(); i++) {
+            auto frontendSource = std::find_if(frontendTargets.begin(), frontendTargets.end(), [&](size_t candidate) {
+                return targets[candidate].compiler->canShareFrontendWith(*targets[i].compiler);
+            });
+            if (frontendSource == frontendTargets.end()) {
+                targets[i].frontendSourceIndex = i;
+                frontendTargets.push_back(i);
+            } else {
+                targets[i].frontendSourceIndex = *frontendSource;
+                backendOnlyTargets.push_back(i);
+            }
+        }
 
-            std::string buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
+        buildTargetsConcurrently(targets, frontendTargets, jobsCount);
+        for (auto i : backendOnlyTargets) {
+            auto &frontendSource = targets[targets[i].frontendSourceIndex];
+            if (false == targets[i].compiler->useIntermediateRepresentationFrom(*frontendSource.compiler)) {
+                // frontend target produced no IR, this target runs its own frontend
+                targets[i].frontendSourceIndex = i;
             }
+        }
+        buildTargetsConcurrently(targets, backendOnlyTargets, jobsCount);
 
+        // logs and archive entries follow target order, not completion order
+        int retVal = 0;
+        for (auto &target : targets) {
+            argsCopy[deviceArgIndex] = target.platform.str();
+            printTargetBuildResult(target, argsCopy, argHelper);
             if (retVal == 0) {
-                if (!pCompiler->isQuiet())
-                    argHelper->printf("Build succeeded for : %s.\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str());
-            } else {
-                argHelper->printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
-                argHelper->printf("Command was:");
-                for (const auto &arg : argsCopy)
-                    argHelper->printf(" %s", arg.c_str());
-                argHelper->printf("\n");
+                retVal = target.retVal;
             }
         }
-
         if (0 != retVal) {
             return retVal;
         }
 
-        fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
+        for (auto &target : targets) {
+            fatbinary.appendFileEntry(pointerSizeInBits + "." + target.name, target.compiler->getPackedDeviceBinaryOutput());
+        }
     }
 
     auto fatbinaryData = fatbinary.encode();
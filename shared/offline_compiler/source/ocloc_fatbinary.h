@@ -11,6 +11,7 @@
 
 #include "igfxfmid.h"
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -37,5 +38,7 @@ PRODUCT_FAMILY asProductId(ConstStringRef product, const std::vector<PRODUCT_FAM
 std::vector<GFXCORE_FAMILY> asGfxCoreIdList(ConstStringRef core);
 void appendPlatformsForGfxCore(GFXCORE_FAMILY core, const std::vector<PRODUCT_FAMILY> &allSupportedPlatforms, std::vector<PRODUCT_FAMILY> &out);
 std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
+constexpr size_t maxFatBinaryJobsCount = 1024U;
+bool parseFatBinaryJobsCount(ConstStringRef jobsArg, size_t &jobsCount);
 
 } // namespace NEO
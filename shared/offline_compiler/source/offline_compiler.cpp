@@ -249,6 +249,32 @@ int OfflineCompiler::build() {
     return retVal;
 }
 
+bool OfflineCompiler::canShareFrontendWith(const OfflineCompiler &other) const {
+    auto buildsFromSource = [](const OfflineCompiler &compiler) {
+        return !compiler.onlySpirV && !compiler.inputFileLlvm && !compiler.inputFileSpirV && !compiler.useLlvmText;
+    };
+    // FCL device context is set up per platform (OCL API version), so it has to match as well
+    return buildsFromSource(*this) && buildsFromSource(other) &&
+           (fclDeviceCtx != nullptr) && (other.fclDeviceCtx != nullptr) &&
+           (hwInfo.capabilityTable.clVersionSupport == other.hwInfo.capabilityTable.clVersionSupport) &&
+           (useLlvmBc == other.useLlvmBc) &&
+           (preferredIntermediateRepresentation == other.preferredIntermediateRepresentation) &&
+           (sourceCode == other.sourceCode) &&
+           (options == other.options) &&
+           (internalOptions == other.internalOptions);
+}
+
+bool OfflineCompiler::useIntermediateRepresentationFrom(const OfflineCompiler &other) {
+    if (other.irBinary == nullptr || other.irBinarySize == 0) {
+        return false;
+    }
+    // the next build() consumes the IR as if it was passed with -spirv_input or -llvm_input
+    sourceCode.assign(other.irBinary, other.irBinarySize);
+    inputFileSpirV = other.isSpirV;
+    inputFileLlvm = !other.isSpirV;
+    return true;
+}
+
 void OfflineCompiler::updateBuildLog(const char *pErrorString, const size_t errorStringSize) {
     std::string errorString = (errorStringSize && pErrorString) ? std::string(pErrorString, pErrorString + errorStringSize) : "";
     if (errorString[0] != '\0') {
@@ -733,7 +759,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-j <jobs>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -765,6 +791,12 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                 -device *          ; will compile all targets
                                                      known to ocloc
 
+  -j <jobs>                     Number of fatbinary targets built concurrently.
+                                0 uses one job per hardware thread.
+                                Targets sharing identical OpenCL C frontend
+                                inputs also share the frontend output.
+                                Default is 1.
+
   -output <filename>            Optional output file base name.
                                 Default is input file's base name.
                                 This base name will be used for all output
@@ -74,6 +74,9 @@ class OfflineCompiler {
         return hwInfo;
     }
 
+    bool canShareFrontendWith(const OfflineCompiler &other) const;
+    bool useIntermediateRepresentationFrom(const OfflineCompiler &other);
+
   protected:
     OfflineCompiler();
 
@@ -14,7 +14,8 @@
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+// per thread - fatbinary targets build concurrently and SIGSEGV/SIGILL are delivered to the faulting thread
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardLinux {
   public:
@@ -11,7 +11,8 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
+// per thread - fatbinary targets build concurrently
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardWindows {
   public:
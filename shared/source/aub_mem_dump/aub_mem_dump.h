@@ -6,11 +6,15 @@
  */
 
 #pragma once
+#include "shared/source/utilities/async_file_writer.h"
+
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #ifndef BIT
 #define BIT(x) (((uint64_t)1) << (x))
@@ -112,6 +116,7 @@ struct AubStream {
         writeMemoryWriteHeader(physAddress, size, addressSpace, CmdServicesMemTraceMemoryWrite::DataTypeHintValues::TraceNotype);
     }
     virtual void writePTE(uint64_t physAddress, uint64_t entry, uint32_t addressSpace) = 0;
+    virtual void invalidateDumpedMemory(uint64_t physAddress, size_t size) {}
     virtual void writeGTT(uint32_t offset, uint64_t entry) = 0;
     void writeMMIO(uint32_t offset, uint32_t value);
     virtual void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) = 0;
@@ -129,6 +134,7 @@ struct AubFileStream : public AubStream {
     void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override;
     void writeMemoryWriteHeader(uint64_t physAddress, size_t size, uint32_t addressSpace, uint32_t hint) override;
     void writePTE(uint64_t physAddress, uint64_t entry, uint32_t addressSpace) override;
+    void invalidateDumpedMemory(uint64_t physAddress, size_t size) override;
     void writeGTT(uint32_t offset, uint64_t entry) override;
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
@@ -145,6 +151,22 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+
+    // AUBDumpAsyncFileWrites
+    std::unique_ptr<NEO::AsyncFileWriter> asyncWriter;
+
+    // AUBDumpSkipUnchangedMemory: last content written to each physical page in this file.
+    // Only the last write touching a page is kept, so a write is skipped only when every page it spans
+    // was last written with the same range, address space and bytes.
+    struct DumpedPage {
+        uint64_t contentHash;
+        uint32_t offsetInPage;
+        uint32_t size;
+        uint32_t addressSpace;
+    };
+    bool isMemoryDumped(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace) const;
+    bool skipUnchangedMemoryWrites = false;
+    std::unordered_map<uint64_t, DumpedPage> dumpedPages;
 };
 
 template <int addressingBits>
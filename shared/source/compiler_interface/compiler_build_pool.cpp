@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_build_pool.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+constexpr size_t CompilerBuildPool::maxDefaultThreadsCount;
+
+CompilerBuildPool::Job::Job(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input, const std::string &key)
+    : compilerInterface(compilerInterface), device(device), key(key),
+      src(input.src.begin(), input.src.end()),
+      apiOptions(input.apiOptions.begin(), input.apiOptions.end()),
+      internalOptions(input.internalOptions.begin(), input.internalOptions.end()),
+      input(input) {
+    this->input.src = ArrayRef<const char>(src.c_str(), src.size());
+    this->input.apiOptions = ArrayRef<const char>(apiOptions.c_str(), apiOptions.size());
+    this->input.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.size());
+}
+
+CompilerBuildPool::Job::Status CompilerBuildPool::Job::wait() {
+    std::unique_lock<std::mutex> lock(mtx);
+    statusChanged.wait(lock, [this]() { return (status == Status::Completed) || (status == Status::Cancelled); });
+    return status;
+}
+
+CompilerBuildPool::Job::Status CompilerBuildPool::Job::getStatus() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return status;
+}
+
+void CompilerBuildPool::Job::copyOutput(TranslationOutput &dst) const {
+    auto copyMemAndSize = [](TranslationOutput::MemAndSize &copyDst, const TranslationOutput::MemAndSize &copySrc) {
+        copyDst.mem.reset();
+        copyDst.size = 0U;
+        if ((nullptr == copySrc.mem) || (0U == copySrc.size)) {
+            return;
+        }
+        copyDst.mem = ::makeCopy(copySrc.mem.get(), copySrc.size);
+        copyDst.size = copySrc.size;
+    };
+
+    dst.intermediateCodeType = output.intermediateCodeType;
+    copyMemAndSize(dst.intermediateRepresentation, output.intermediateRepresentation);
+    copyMemAndSize(dst.deviceBinary, output.deviceBinary);
+    copyMemAndSize(dst.debugData, output.debugData);
+    dst.frontendCompilerLog = output.frontendCompilerLog;
+    dst.backendCompilerLog = output.backendCompilerLog;
+}
+
+CompilerBuildPool::CompilerBuildPool(size_t maxThreadsCount)
+    : maxThreadsCount(std::max(maxThreadsCount, static_cast<size_t>(1U))) {
+}
+
+CompilerBuildPool::~CompilerBuildPool() {
+    std::vector<std::shared_ptr<Job>> cancelledJobs;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+        cancelledJobs.swap(queuedJobs);
+    }
+    jobsAvailable.notify_all();
+    for (auto &job : cancelledJobs) {
+        finishJob(*job, Job::Status::Cancelled);
+    }
+    // no workers are started once stopping is set
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+std::string CompilerBuildPool::getDeduplicationKey(const Device &device, const TranslationInput &input) {
+    if ((false == input.specializedValues.empty()) || (nullptr != input.GTPinInput) || (nullptr != input.tracingOptions)) {
+        return "";
+    }
+
+    auto key = CompilerCache::getCachedFileName(device.getHardwareInfo(), input.src, input.apiOptions, input.internalOptions);
+    key.append("_" + std::to_string(static_cast<uint64_t>(input.srcType)));
+    key.append("_" + std::to_string(static_cast<uint64_t>(input.preferredIntermediateType)));
+    key.append("_" + std::to_string(static_cast<uint64_t>(input.outType)));
+    key.append(input.allowCaching ? "_c" : "_n");
+    return key;
+}
+
+size_t CompilerBuildPool::getDefaultThreadsCount() {
+    if (DebugManager.flags.CompilerBuildPoolThreads.get() != -1) {
+        return static_cast<size_t>(std::max(1, DebugManager.flags.CompilerBuildPoolThreads.get()));
+    }
+    return std::min(static_cast<size_t>(std::max(1U, std::thread::hardware_concurrency())), maxDefaultThreadsCount);
+}
+
+size_t CompilerBuildPool::getThreadsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+}
+
+std::shared_ptr<CompilerBuildPool::Job> CompilerBuildPool::findInFlightJob(const CompilerInterface &compilerInterface, const Device &device, const std::string &key) {
+    if (key.empty()) {
+        return nullptr;
+    }
+    for (auto jobs : {&queuedJobs, &runningJobs}) {
+        for (auto &job : *jobs) {
+            if ((&job->compilerInterface == &compilerInterface) && (&job->device == &device) && (job->key == key)) {
+                return job;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<CompilerBuildPool::Job> CompilerBuildPool::submit(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input) {
+    auto key = getDeduplicationKey(device, input);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto inFlightJob = findInFlightJob(compilerInterface, device, key);
+    if (nullptr != inFlightJob) {
+        return inFlightJob;
+    }
+
+    auto job = std::make_shared<Job>(compilerInterface, device, input, key);
+    if (stopping) {
+        lock.unlock();
+        finishJob(*job, Job::Status::Cancelled);
+        return job;
+    }
+    queuedJobs.push_back(job);
+    if ((queuedJobs.size() > idleThreadsCount) && (workers.size() < maxThreadsCount)) {
+        workers.push_back(Thread::create(processJobsOnThread, this));
+    }
+    lock.unlock();
+    jobsAvailable.notify_one();
+    return job;
+}
+
+TranslationOutput::ErrorCode CompilerBuildPool::build(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input, TranslationOutput &output) {
+    auto key = getDeduplicationKey(device, input);
+    if (key.empty()) {
+        return compilerInterface.build(device, input, output);
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto job = findInFlightJob(compilerInterface, device, key);
+    if (nullptr != job) {
+        lock.unlock();
+        if (Job::Status::Completed != wait(job)) {
+            return compilerInterface.build(device, input, output);
+        }
+    } else {
+        // registered as running, so that identical builds requested meanwhile wait for this one
+        job = std::make_shared<Job>(compilerInterface, device, input, key);
+        job->status = Job::Status::Running;
+        runningJobs.push_back(job);
+        lock.unlock();
+        runJob(job);
+    }
+    job->copyOutput(output);
+    return job->getErrorCode();
+}
+
+CompilerBuildPool::Job::Status CompilerBuildPool::wait(const std::shared_ptr<Job> &job) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto queuedJob = std::find(queuedJobs.begin(), queuedJobs.end(), job);
+    if (queuedJob == queuedJobs.end()) {
+        lock.unlock();
+        return job->wait();
+    }
+    queuedJobs.erase(queuedJob);
+    runningJobs.push_back(job);
+    {
+        std::lock_guard<std::mutex> jobLock(job->mtx);
+        job->status = Job::Status::Running;
+    }
+    lock.unlock();
+    runJob(job);
+    return Job::Status::Completed;
+}
+
+size_t CompilerBuildPool::getNumQueuedJobs() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return queuedJobs.size();
+}
+
+void CompilerBuildPool::finishJob(Job &job, Job::Status status) {
+    {
+        std::lock_guard<std::mutex> lock(job.mtx);
+        job.status = status;
+    }
+    job.statusChanged.notify_all();
+}
+
+void *CompilerBuildPool::processJobsOnThread(void *arg) {
+    reinterpret_cast<CompilerBuildPool *>(arg)->processJobs();
+    return nullptr;
+}
+
+void CompilerBuildPool::processJobs() {
+    while (true) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            idleThreadsCount++;
+            jobsAvailable.wait(lock, [this]() { return stopping || (false == queuedJobs.empty()); });
+            idleThreadsCount--;
+            if (stopping) {
+                return;
+            }
+            job = queuedJobs.front();
+            queuedJobs.erase(queuedJobs.begin());
+            runningJobs.push_back(job);
+            std::lock_guard<std::mutex> jobLock(job->mtx);
+            job->status = Job::Status::Running;
+        }
+
+        runJob(job);
+    }
+}
+
+void CompilerBuildPool::runJob(const std::shared_ptr<Job> &job) {
+    job->errorCode = job->compilerInterface.build(job->device, job->input, job->output);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        runningJobs.erase(std::find(runningJobs.begin(), runningJobs.end(), job));
+    }
+    finishJob(*job, Job::Status::Completed);
+}
+
+} // namespace NEO
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Device;
+
+// Runs CompilerInterface::build requests on driver-owned worker threads, one pool per execution environment.
+// Workers are started on demand, up to the pool's limit, and pick queued builds in submission order.
+// Submitting a build identical to one still queued or running (same compiler interface, device and compiler cache key)
+// returns the in-flight job instead of compiling the same input again.
+class CompilerBuildPool : NonCopyableOrMovableClass {
+  public:
+    class Job : NonCopyableOrMovableClass {
+      public:
+        enum class Status : uint32_t {
+            Queued,
+            Running,
+            Completed,
+            Cancelled
+        };
+
+        Job(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input, const std::string &key);
+
+        // blocks until job is completed or cancelled
+        Status wait();
+        Status getStatus();
+
+        // valid once job is completed
+        TranslationOutput::ErrorCode getErrorCode() const {
+            return errorCode;
+        }
+        // every requester of a deduplicated job gets own copy of the output
+        void copyOutput(TranslationOutput &dst) const;
+
+      protected:
+        friend class CompilerBuildPool;
+
+        CompilerInterface &compilerInterface;
+        const Device &device;
+        std::string key;
+
+        std::string src;
+        std::string apiOptions;
+        std::string internalOptions;
+        TranslationInput input;
+
+        Status status = Status::Queued;
+        std::mutex mtx;
+        std::condition_variable statusChanged;
+        TranslationOutput::ErrorCode errorCode = TranslationOutput::ErrorCode::UnknownError;
+        TranslationOutput output;
+    };
+
+    explicit CompilerBuildPool(size_t maxThreadsCount);
+    // cancels queued jobs and waits for running ones
+    ~CompilerBuildPool();
+
+    // input's buffers are copied, caller doesn't need to keep them alive
+    std::shared_ptr<Job> submit(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input);
+    // compiles on the calling thread, unless identical build is already in flight - then its output is used
+    TranslationOutput::ErrorCode build(CompilerInterface &compilerInterface, const Device &device, const TranslationInput &input, TranslationOutput &output);
+    // compiles the job on the calling thread if no worker picked it up yet, otherwise blocks until it's done
+    Job::Status wait(const std::shared_ptr<Job> &job);
+
+    size_t getThreadsCount();
+    size_t getMaxThreadsCount() const {
+        return maxThreadsCount;
+    }
+    size_t getNumQueuedJobs();
+
+    // empty key disables deduplication of the input
+    static std::string getDeduplicationKey(const Device &device, const TranslationInput &input);
+    static size_t getDefaultThreadsCount();
+
+    static constexpr size_t maxDefaultThreadsCount = 4U;
+
+  protected:
+    static void *processJobsOnThread(void *arg);
+    void processJobs();
+    void runJob(const std::shared_ptr<Job> &job);
+    std::shared_ptr<Job> findInFlightJob(const CompilerInterface &compilerInterface, const Device &device, const std::string &key);
+    void finishJob(Job &job, Job::Status status);
+
+    const size_t maxThreadsCount;
+    std::mutex mtx;
+    std::condition_variable jobsAvailable;
+    bool stopping = false;
+    size_t idleThreadsCount = 0U;
+    std::vector<std::shared_ptr<Job>> queuedJobs;
+    std::vector<std::shared_ptr<Job>> runningJobs;
+    std::vector<std::unique_ptr<Thread>> workers;
+};
+} // namespace NEO
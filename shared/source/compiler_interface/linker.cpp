@@ -23,6 +23,20 @@
 
 namespace NEO {
 
+SymbolId SymbolNameTable::intern(const std::string &symbolName) {
+    auto newSymbolId = static_cast<SymbolId>(names.size());
+    auto inserted = ids.emplace(symbolName, newSymbolId);
+    if (inserted.second) {
+        names.push_back(symbolName);
+    }
+    return inserted.first->second;
+}
+
+SymbolId SymbolNameTable::find(const std::string &symbolName) const {
+    auto symbolIt = ids.find(symbolName);
+    return (symbolIt != ids.end()) ? symbolIt->second : invalidSymbolId;
+}
+
 bool LinkerInput::decodeGlobalVariablesSymbolTable(const void *data, uint32_t numEntries) {
     auto symbolEntryIt = reinterpret_cast<const vISA::GenSymEntry *>(data);
     auto symbolEntryEnd = symbolEntryIt + numEntries;
@@ -32,6 +46,7 @@ bool LinkerInput::decodeGlobalVariablesSymbolTable(const void *data, uint32_t nu
         SymbolInfo &symbolInfo = symbols[symbolEntryIt->s_name];
         symbolInfo.offset = symbolEntryIt->s_offset;
         symbolInfo.size = symbolEntryIt->s_size;
+        symbolInfo.symbolId = symbolNames.intern(symbolEntryIt->s_name);
         switch (symbolEntryIt->s_type) {
         default:
             DEBUG_BREAK_IF(true);
@@ -58,6 +73,7 @@ bool LinkerInput::decodeExportedFunctionsSymbolTable(const void *data, uint32_t
         SymbolInfo &symbolInfo = symbols[symbolEntryIt->s_name];
         symbolInfo.offset = symbolEntryIt->s_offset;
         symbolInfo.size = symbolEntryIt->s_size;
+        symbolInfo.symbolId = symbolNames.intern(symbolEntryIt->s_name);
         switch (symbolEntryIt->s_type) {
         default:
             DEBUG_BREAK_IF(true);
@@ -97,6 +113,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
         relocInfo.symbolName = relocEntryIt->r_symbol;
+        relocInfo.symbolId = symbolNames.intern(relocInfo.symbolName);
         relocInfo.symbolSegment = SegmentType::Unknown;
         relocInfo.relocationSegment = SegmentType::Instructions;
         switch (relocEntryIt->r_type) {
@@ -129,10 +146,25 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::GlobalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::GlobalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    this->dataRelocations.rbegin()->symbolId = symbolNames.intern(relocationInfo.symbolName);
+}
+
+SymbolId Linker::resolveSymbolId(SymbolId symbolId, const std::string &symbolName) {
+    if (invalidSymbolId != symbolId) {
+        return symbolId;
+    }
+    auto &inputSymbolNames = data.getSymbolNames();
+    symbolId = inputSymbolNames.find(symbolName);
+    if (invalidSymbolId != symbolId) {
+        return symbolId;
+    }
+    // unlisted names get ids past the ones of LinkerInput's table
+    return static_cast<SymbolId>(inputSymbolNames.size()) + unlistedSymbolNames.intern(symbolName);
 }
 
 bool Linker::processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions) {
     relocatedSymbols.reserve(data.getSymbols().size());
+    relocatedSymbolsById.reserve(data.getSymbols().size());
     for (auto &symbol : data.getSymbols()) {
         const SegmentInfo *seg = nullptr;
         switch (symbol.second.segment) {
@@ -154,7 +186,9 @@ bool Linker::processRelocations(const SegmentInfo &globalVariables, const Segmen
             DEBUG_BREAK_IF(true);
             return false;
         }
-        relocatedSymbols[symbol.first] = {symbol.second, gpuAddress};
+        auto &relocatedSymbol = relocatedSymbols[symbol.first];
+        relocatedSymbol = {symbol.second, gpuAddress};
+        relocatedSymbolsById[resolveSymbolId(symbol.second.symbolId, symbol.first)] = &relocatedSymbol;
     }
     return true;
 }
@@ -163,11 +197,15 @@ uint32_t addressSizeInBytes(LinkerInput::RelocationInfo::Type relocationtype) {
     return (relocationtype == LinkerInput::RelocationInfo::Type::Address) ? sizeof(uintptr_t) : sizeof(uint32_t);
 }
 void Linker::patchAddress(void *relocAddress, const Linker::RelocatedSymbol &symbol, const Linker::RelocationInfo &relocation) {
-    uint64_t gpuAddressAs64bit = static_cast<uint64_t>(symbol.gpuAddress);
-    switch (relocation.type) {
+    patchAddress(relocAddress, symbol.gpuAddress, relocation.type);
+}
+
+void Linker::patchAddress(void *relocAddress, uintptr_t gpuAddress, RelocationInfo::Type relocationType) {
+    uint64_t gpuAddressAs64bit = static_cast<uint64_t>(gpuAddress);
+    switch (relocationType) {
     default:
-        UNRECOVERABLE_IF(RelocationInfo::Type::Address != relocation.type);
-        *reinterpret_cast<uintptr_t *>(relocAddress) = symbol.gpuAddress;
+        UNRECOVERABLE_IF(RelocationInfo::Type::Address != relocationType);
+        *reinterpret_cast<uintptr_t *>(relocAddress) = gpuAddress;
         break;
     case RelocationInfo::Type::AddressLow:
         *reinterpret_cast<uint32_t *>(relocAddress) = static_cast<uint32_t>(gpuAddressAs64bit & 0xffffffff);
@@ -183,6 +221,7 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
         return;
     }
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
+    PatchPlan patchPlan;
     auto segIt = instructionsSegments.begin();
     for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
          relocsIt != relocsEnd; ++relocsIt, ++segIt) {
@@ -193,22 +232,29 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
                 continue;
             }
             UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
-            auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+            auto symbolIt = relocatedSymbolsById.find(resolveSymbolId(relocation.symbolId, relocation.symbolName));
 
             bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
-            bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
+            bool unresolvedExternal = (symbolIt == relocatedSymbolsById.end());
 
+            uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
             DEBUG_BREAK_IF(invalidOffset);
             if (invalidOffset || unresolvedExternal) {
-                uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
                 outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
                 continue;
             }
 
-            patchAddress(relocAddress, symbolIt->second, relocation);
+            patchPlan.push_back(PatchPlanEntry{relocation.offset, symbolIt->second->gpuAddress, relocation.type, segId});
         }
     }
+    applyPatchPlan(patchPlan, instructionsSegments);
+}
+
+void Linker::applyPatchPlan(const PatchPlan &patchPlan, const PatchableSegments &instructionsSegments) {
+    for (const auto &patch : patchPlan) {
+        auto relocAddress = ptrOffset(instructionsSegments[patch.instructionsSegmentId].hostPointer, static_cast<uintptr_t>(patch.offset));
+        patchAddress(relocAddress, patch.gpuAddress, patch.type);
+    }
 }
 
 void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
@@ -45,10 +45,33 @@ inline const char *asString(SegmentType segment) {
     }
 }
 
+using SymbolId = uint32_t;
+static constexpr SymbolId invalidSymbolId = std::numeric_limits<SymbolId>::max();
+
+// Interns symbol names into dense ids, so that symbols and relocations can be matched without string hashing.
+// Ids are meaningful only within the table that produced them (one LinkerInput or one link set).
+class SymbolNameTable {
+  public:
+    SymbolId intern(const std::string &symbolName);
+    SymbolId find(const std::string &symbolName) const;
+
+    const std::string &getName(SymbolId symbolId) const {
+        return names[symbolId];
+    }
+    size_t size() const {
+        return names.size();
+    }
+
+  protected:
+    std::unordered_map<std::string, SymbolId> ids;
+    std::vector<std::string> names;
+};
+
 struct SymbolInfo {
     uint32_t offset = std::numeric_limits<uint32_t>::max();
     uint32_t size = std::numeric_limits<uint32_t>::max();
     SegmentType segment = SegmentType::Unknown;
+    SymbolId symbolId = invalidSymbolId;
 };
 
 struct LinkerInput {
@@ -83,6 +106,7 @@ struct LinkerInput {
         };
 
         std::string symbolName;
+        SymbolId symbolId = invalidSymbolId;
         uint64_t offset = std::numeric_limits<uint64_t>::max();
         Type type = Type::Unknown;
         SegmentType relocationSegment = SegmentType::Unknown;
@@ -120,6 +144,11 @@ struct LinkerInput {
         return dataRelocations;
     }
 
+    // symbolId of decoded symbols and relocations indexes this table
+    const SymbolNameTable &getSymbolNames() const {
+        return symbolNames;
+    }
+
     void setPointerSize(Traits::PointerSize pointerSize) {
         traits.pointerSize = pointerSize;
     }
@@ -133,6 +162,7 @@ struct LinkerInput {
     SymbolMap symbols;
     RelocationsPerInstSegment relocations;
     Relocations dataRelocations;
+    SymbolNameTable symbolNames;
     int32_t exportedFunctionsSegmentId = -1;
     bool valid = true;
 };
@@ -161,9 +191,19 @@ struct Linker {
         uintptr_t gpuAddress = std::numeric_limits<uintptr_t>::max();
     };
 
+    // Relocation resolved against symbol's gpu address, ready to be written to instructions segment
+    struct PatchPlanEntry {
+        uint64_t offset = 0U;
+        uintptr_t gpuAddress = 0U;
+        RelocationInfo::Type type = RelocationInfo::Type::Unknown;
+        uint32_t instructionsSegmentId = 0U;
+    };
+
     using RelocatedSymbolsMap = std::unordered_map<std::string, RelocatedSymbol>;
+    using RelocatedSymbolsById = std::unordered_map<SymbolId, const RelocatedSymbol *>;
     using PatchableSegments = std::vector<PatchableSegment>;
     using UnresolvedExternals = std::vector<UnresolvedExternal>;
+    using PatchPlan = std::vector<PatchPlanEntry>;
 
     Linker(const LinkerInput &data)
         : data(data) {
@@ -188,14 +228,21 @@ struct Linker {
         return LinkingStatus::LinkedFully;
     }
     static void patchAddress(void *relocAddress, const RelocatedSymbol &symbol, const RelocationInfo &relocation);
+    static void patchAddress(void *relocAddress, uintptr_t gpuAddress, RelocationInfo::Type relocationType);
+    static void applyPatchPlan(const PatchPlan &patchPlan, const PatchableSegments &instructionsSegments);
     RelocatedSymbolsMap extractRelocatedSymbols() {
+        relocatedSymbolsById.clear();
         return RelocatedSymbolsMap(std::move(relocatedSymbols));
     }
 
   protected:
     const LinkerInput &data;
     RelocatedSymbolsMap relocatedSymbols;
+    RelocatedSymbolsById relocatedSymbolsById;
+    // names of symbols and relocations filled in without going through LinkerInput's table
+    SymbolNameTable unlistedSymbolNames;
 
+    SymbolId resolveSymbolId(SymbolId symbolId, const std::string &symbolName);
     bool processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals);
@@ -16,6 +16,8 @@ DECLARE_DEBUG_VARIABLE(std::string, AUBDumpCaptureFileName, std::string("unk"),
 DECLARE_DEBUG_VARIABLE(std::string, AUBDumpFilterKernelName, std::string("unk"), "Name of kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(std::string, AUBDumpToggleFileName, std::string("unk"), "Name of file to save AUB in toggle mode")
 DECLARE_DEBUG_VARIABLE(std::string, OverrideGdiPath, std::string("unk"), "When different value than \"unk\", will override default path to gdi library.")
+DECLARE_DEBUG_VARIABLE(std::string, DrmCapsSnapshotDirectory, std::string("unk"), "When different value than \"unk\", raw device capabilities queried from the kernel driver are stored in and reused from this directory")
+DECLARE_DEBUG_VARIABLE(std::string, BinaryApiTraceFile, std::string("unk"), "When different value than \"unk\", OpenCL API calls are recorded into this file in compact binary form, see scripts/decode_binary_api_trace.py")
 DECLARE_DEBUG_VARIABLE(std::string, AubDumpAddMmioRegistersList, std::string("unk"), "Semicolon separated sequence of additional MMIO registers offset;values pairs i.e. 0x111;0x123;0x222;0x456")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterNamedKernelStartIdx, 0, "Start index of named kernel to AUB capture")
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterNamedKernelEndIdx, -1, "End index of named kernel to AUB capture")
@@ -28,12 +30,16 @@ DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to o
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSendBufferSize, -1, "Size in bytes of buffer batching TBX socket requests until the next response is awaited: -1 - default (disabled), 0 - disabled, >0 - enabled. Requires UseAubStream=0, aub_stream owns its own TBX connection")
+DECLARE_DEBUG_VARIABLE(bool, TbxSkipUnchangedMemory, false, "Skip TBX page writes whose content hash matches what simulator memory is known to contain, pages of GPU writable resident allocations are known again only after download. Requires UseAubStream=0, aub_stream writes memory itself")
 DECLARE_DEBUG_VARIABLE(bool, FlattenBatchBufferForAUBDump, false, "Dump multi-level batch buffers to AUB as single, flat batch buffer")
 DECLARE_DEBUG_VARIABLE(bool, AddPatchInfoCommentsForAUBDump, false, "Dump comments containing allocations and patching information")
 DECLARE_DEBUG_VARIABLE(bool, UseAubStream, true, "Use aub_stream for aub dumping")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueReadOnly, false, "Force dumping buffers and images on clEnqueueReadBuffer/Image only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpAllocsOnEnqueueSVMMemcpyOnly, false, "Force dumping allocations on clEnqueueSVMMemcpy only (blocking calls)")
 DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing every allocation in local memory address space")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpAsyncFileWrites, false, "Write AUB file on a background thread fed by a bounded queue of staged chunks. Requires UseAubStream=0, aub_stream writes its own file")
+DECLARE_DEBUG_VARIABLE(bool, AUBDumpSkipUnchangedMemory, false, "Skip AUB memory writes whose content hash matches what was last written to the same physical pages, pages of GPU writable resident allocations are forgotten on every flush. Requires UseAubStream=0, aub_stream writes its own file")
 
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableTimestampPacketOptimizations, false, "Allocate new allocation per node + dont reuse old nodes")
@@ -53,6 +59,12 @@ DECLARE_DEBUG_VARIABLE(bool, ForceImplicitFlush, false, "Flush after each enqueu
 DECLARE_DEBUG_VARIABLE(bool, ForcePipeControlPriorToWalker, false, "Allows to force pipe contron prior to walker.")
 DECLARE_DEBUG_VARIABLE(bool, ZebinAppendElws, false, "Append crossthread data with enqueue local work size")
 DECLARE_DEBUG_VARIABLE(bool, ZebinIgnoreIcbeVersion, false, "Ignore IGC\'s ICBE version")
+DECLARE_DEBUG_VARIABLE(int32_t, ZebinDecodeThreads, -1, "-1: default - decode kernels in parallel only for large binaries, >0: maximum number of threads decoding zebin kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableProgramInfoCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. Store decoded zebin kernel descriptors in compiler cache and restore them instead of decoding .ze_info")
+DECLARE_DEBUG_VARIABLE(int32_t, PatchTokensDecodeThreads, -1, "-1: default - decode, validate and populate patch token kernels in parallel only for large programs, >0: maximum number of threads processing patch token kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableProgramArtifactsSharing, -1, "-1: default (disabled), 0: disabled, 1: enabled. Programs built in one context from identical binary and options share kernels ISA and constant surface")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCompilerBuildPool, -1, "-1: default (disabled), 0: disabled, 1: enabled. Program and module builds go through execution environment's compiler build pool, identical builds in flight are compiled once and multi-device programs are compiled in parallel")
+DECLARE_DEBUG_VARIABLE(int32_t, CompilerBuildPoolThreads, -1, "-1: default - one thread per hardware thread, at most 4, >0: maximal number of compiler build pool threads")
 DECLARE_DEBUG_VARIABLE(bool, UseExternalAllocatorForSshAndDsh, false, "Use 32 bit external Allocator for ssh and dsh in Level Zero")
 DECLARE_DEBUG_VARIABLE(std::string, ForceDeviceId, std::string("unk"), "DeviceId selected for testing")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceL1Caching, -1, "-1: default, 0: disable, 1: enable, When set to true driver will program L1 cache policy for surface state and stateless accessess")
@@ -137,6 +149,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater then 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInterfaceDescriptorTemplates, -1, "-1: default (enabled), 0: disabled, 1: enabled. Reuse per-kernel INTERFACE_DESCRIPTOR_DATA template and patch only heap offsets on repeated dispatches")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImageSurfaceStateTemplates, -1, "-1: default (enabled), 0: disabled, 1: enabled. Reuse encoded RENDER_SURFACE_STATE of images with identical layout and patch only the base address")
+DECLARE_DEBUG_VARIABLE(int32_t, LevelZeroBuiltinsInitMode, -1, "-1: default (lazy), 0: builtins are loaded on first use, 1: all builtins are loaded at device creation, 2: lazy with copy and fill builtins warmed up on a background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedIsaHeap, -1, "-1: default (disabled), 0: disabled, 1: enabled. Sub-allocate ISA of non-builtin kernels from shared per-device instruction heap arenas")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -182,6 +198,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-
 DECLARE_DEBUG_VARIABLE(int32_t, EnableVaLibCalls, -1, "-1: default, 0: disable, 1: enable cl-va sharing lib calls")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleRootDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleSubDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) sub devices during initialization.")
+DECLARE_DEBUG_VARIABLE(bool, EnableParallelRootDeviceInitialization, false, "Create root devices concurrently, one worker thread per root device")
+DECLARE_DEBUG_VARIABLE(bool, EnableMetricStreamerBackgroundDrain, false, "Level Zero metric streamer drains oa reports into a host buffer on a background thread, readData consumes the host buffer")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitAmountOfReturnedDevices, 0, "0: default - disable, 1+: Driver will limit the number of devices returned from clGetDeviceIds to N.")
 DECLARE_DEBUG_VARIABLE(int32_t, Enable64kbpages, -1, "-1: default behaviour, 0 Disables, 1 Enables support for 64KB pages for driver allocated fine grain svm buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableKmdNotify, -1, "-1: dont override, 0: disable, 1: enable")
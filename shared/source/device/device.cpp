@@ -13,6 +13,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/os_context.h"
@@ -42,6 +43,7 @@ Device::~Device() {
         engine.commandStreamReceiver->flushBatchedSubmissions();
     }
 
+    isaHeapAllocator.reset();
     commandStreamReceivers.clear();
     executionEnvironment->memoryManager->waitForDeletions();
 
@@ -92,6 +94,10 @@ bool Device::createDeviceImpl() {
 
     executionEnvironment->memoryManager->setForce32BitAllocations(getDeviceInfo().force32BitAddressess);
 
+    if (DebugManager.flags.EnableSharedIsaHeap.get() == 1) {
+        isaHeapAllocator = std::make_unique<IsaHeapAllocator>(*this);
+    }
+
     if (DebugManager.flags.EnableExperimentalCommandBuffer.get() > 0) {
         for (auto &engine : engines) {
             auto csr = engine.commandStreamReceiver;
@@ -19,6 +19,7 @@
 #include "opencl/source/os_interface/performance_counters.h"
 
 namespace NEO {
+class IsaHeapAllocator;
 class OSTime;
 class SourceLevelDebugger;
 
@@ -52,6 +53,7 @@ class Device : public ReferenceTrackedObject<Device> {
     const std::vector<EngineControl> *getNonEmptyEngineGroup(size_t index) const;
     EngineControl &getEngine(uint32_t index);
     EngineControl &getDefaultEngine();
+    uint32_t getDefaultEngineIndex() const { return defaultEngineIndex; }
     EngineControl &getInternalEngine();
     std::atomic<uint32_t> &getSelectorCopyEngine();
     MemoryManager *getMemoryManager() const;
@@ -89,6 +91,7 @@ class Device : public ReferenceTrackedObject<Device> {
     }
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
+    IsaHeapAllocator *getIsaHeapAllocator() const { return isaHeapAllocator.get(); }
 
     virtual uint32_t getRootDeviceIndex() const = 0;
     virtual uint32_t getNumAvailableDevices() const = 0;
@@ -125,6 +128,7 @@ class Device : public ReferenceTrackedObject<Device> {
     HardwareCapabilities hardwareCapabilities = {};
     std::unique_ptr<OSTime> osTime;
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<IsaHeapAllocator> isaHeapAllocator;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::vector<EngineControl> engines;
     std::vector<std::vector<EngineControl>> engineGroups;
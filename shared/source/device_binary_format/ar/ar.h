@@ -30,8 +30,14 @@ namespace SpecialFileNames {
 static constexpr ConstStringRef longFileNamesFile = "//";
 static const char longFileNamePrefix = '/';
 static const char fileNameTerminator = '/';
+static constexpr ConstStringRef indexFile = "ar_index";
 } // namespace SpecialFileNames
 
+// Optional index file is stored as the first file entry of the archive.
+// It consists of "<fileName> <fileEntryHeaderOffset>\n" lines, where offsets are relative to the beginning of the archive
+// and are zero-padded to indexOffsetDigits, so that the index can be created before the final layout is known.
+static constexpr uint32_t indexOffsetDigits = 12U;
+
 } // namespace Ar
 
 } // namespace NEO
@@ -66,6 +66,57 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
     return ret;
 }
 
+ArFileEntryHeaderAndData findIndexedFile(const ArrayRef<const uint8_t> binary, ConstStringRef fileName) {
+    if ((false == isAr(binary)) || (binary.size() < arMagic.size() + sizeof(ArFileEntryHeader))) {
+        return {};
+    }
+
+    auto indexHeader = reinterpret_cast<const ArFileEntryHeader *>(binary.begin() + arMagic.size());
+    if (readUnpaddedString<sizeof(indexHeader->identifier)>(indexHeader->identifier) != SpecialFileNames::indexFile) {
+        return {};
+    }
+    uint64_t indexSize = readDecimal<sizeof(indexHeader->fileSizeInBytes)>(indexHeader->fileSizeInBytes);
+    if (indexSize > binary.size() - arMagic.size() - sizeof(ArFileEntryHeader)) {
+        return {};
+    }
+
+    ConstStringRef index(reinterpret_cast<const char *>(indexHeader + 1), static_cast<size_t>(indexSize));
+    size_t lineBegin = 0U;
+    while (lineBegin < index.size()) {
+        size_t lineEnd = lineBegin;
+        while ((lineEnd < index.size()) && ('\n' != index[lineEnd])) {
+            ++lineEnd;
+        }
+        ConstStringRef line(index.begin() + lineBegin, lineEnd - lineBegin);
+        lineBegin = lineEnd + 1;
+
+        if ((line.size() != fileName.size() + 1 + indexOffsetDigits) || (' ' != line[fileName.size()]) || (ConstStringRef(line.begin(), fileName.size()) != fileName)) {
+            continue;
+        }
+
+        uint64_t fileEntryHeaderOffset = readDecimal<indexOffsetDigits>(line.begin() + fileName.size() + 1);
+        if (fileEntryHeaderOffset + sizeof(ArFileEntryHeader) > binary.size()) {
+            return {};
+        }
+        auto fileEntryHeader = reinterpret_cast<const ArFileEntryHeader *>(binary.begin() + fileEntryHeaderOffset);
+        auto fileEntryDataPos = reinterpret_cast<const uint8_t *>(fileEntryHeader + 1);
+        uint64_t fileSize = readDecimal<sizeof(fileEntryHeader->fileSizeInBytes)>(fileEntryHeader->fileSizeInBytes);
+        if (fileSize > static_cast<uint64_t>(binary.end() - fileEntryDataPos)) {
+            return {};
+        }
+
+        ArFileEntryHeaderAndData fileEntry = {};
+        fileEntry.fileName = readUnpaddedString<sizeof(fileEntryHeader->identifier)>(fileEntryHeader->identifier);
+        if (fileEntry.fileName != fileName) {
+            return {}; // stale index
+        }
+        fileEntry.fullHeader = fileEntryHeader;
+        fileEntry.fileData = ArrayRef<const uint8_t>(fileEntryDataPos, static_cast<size_t>(fileSize));
+        return fileEntry;
+    }
+    return {};
+}
+
 } // namespace Ar
 
 } // namespace NEO
@@ -81,6 +81,10 @@ inline ConstStringRef readLongFileName(ConstStringRef longFileNamesSection, size
 
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings);
 
+// Looks up file entry using archive's index file without walking remaining file entries.
+// Returns entry with nullptr fullHeader when archive has no index or file is not listed in it.
+ArFileEntryHeaderAndData findIndexedFile(const ArrayRef<const uint8_t> binary, ConstStringRef fileName);
+
 } // namespace Ar
 
 } // namespace NEO
@@ -7,6 +7,7 @@
 
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -15,6 +16,18 @@
 namespace NEO {
 namespace Ar {
 
+namespace {
+ArFileEntryHeader createFileEntryHeader(const ConstStringRef fileName, size_t fileSize) {
+    ArFileEntryHeader header = {};
+    memcpy_s(header.identifier, sizeof(header.identifier), fileName.begin(), fileName.size());
+    header.identifier[fileName.size()] = SpecialFileNames::fileNameTerminator;
+    auto sizeString = std::to_string(fileSize);
+    UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
+    memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
+    return header;
+}
+} // namespace
+
 ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData) {
     if (fileName.size() > sizeof(ArFileEntryHeader::identifier) - 1) {
         return nullptr; // encoding long identifiers is not supported
@@ -24,7 +37,7 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     }
 
     auto alignedFileSize = fileData.size() + (fileData.size() & 1U);
-    ArFileEntryHeader header = {};
+    ArFileEntryHeader header = createFileEntryHeader(fileName, fileData.size());
 
     if (padTo8Bytes && (0 != ((fileEntries.size() + sizeof(ArFileEntryHeader)) % 8))) {
         ArFileEntryHeader paddingHeader = {};
@@ -40,13 +53,11 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
         this->fileEntries.resize(this->fileEntries.size() + paddingSize, ' ');
     }
 
-    memcpy_s(header.identifier, sizeof(header.identifier), fileName.begin(), fileName.size());
-    header.identifier[fileName.size()] = SpecialFileNames::fileNameTerminator;
-    auto sizeString = std::to_string(fileData.size());
-    UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
-    memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
     this->fileEntries.reserve(this->fileEntries.size() + sizeof(header) + alignedFileSize);
     auto newFileHeaderOffset = this->fileEntries.size();
+    if (createIndex) {
+        this->indexEntries.push_back({fileName.str(), newFileHeaderOffset});
+    }
     this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
     this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
     this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
@@ -55,10 +66,45 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
 
 std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
+    auto index = encodeIndex();
+    ret.reserve(arMagic.size() + index.size() + this->fileEntries.size());
     ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
+    ret.insert(ret.end(), index.begin(), index.end());
     ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
     return ret;
 }
 
+std::vector<uint8_t> ArEncoder::encodeIndex() const {
+    if ((false == createIndex) || this->indexEntries.empty()) {
+        return {};
+    }
+
+    size_t indexSize = 0U;
+    for (auto &entry : this->indexEntries) {
+        indexSize += entry.fileName.size() + 1 + indexOffsetDigits + 1;
+    }
+    if (padTo8Bytes) {
+        indexSize = alignUp(sizeof(ArFileEntryHeader) + indexSize, 8) - sizeof(ArFileEntryHeader); // keep following file entries 8-byte aligned
+    }
+    indexSize += indexSize & 1U; // 2-byte alignment
+
+    auto filesOffset = arMagic.size() + sizeof(ArFileEntryHeader) + indexSize;
+    std::string indexData;
+    indexData.reserve(indexSize);
+    for (auto &entry : this->indexEntries) {
+        auto offsetString = std::to_string(filesOffset + entry.fileEntryHeaderOffset);
+        UNRECOVERABLE_IF(offsetString.length() > indexOffsetDigits);
+        indexData.append(entry.fileName + ' ' + std::string(indexOffsetDigits - offsetString.length(), '0') + offsetString + '\n');
+    }
+    indexData.resize(indexSize, '\n');
+
+    auto header = createFileEntryHeader(SpecialFileNames::indexFile, indexData.size());
+    std::vector<uint8_t> ret;
+    ret.reserve(sizeof(header) + indexData.size());
+    ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
+    ret.insert(ret.end(), indexData.begin(), indexData.end());
+    return ret;
+}
+
 } // namespace Ar
 } // namespace NEO
@@ -12,19 +12,29 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstring>
+#include <string>
 #include <vector>
 
 namespace NEO {
 namespace Ar {
 
 struct ArEncoder {
-    ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
+    ArEncoder(bool padTo8Bytes = false, bool createIndex = false) : padTo8Bytes(padTo8Bytes), createIndex(createIndex) {}
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
 
   protected:
+    struct IndexEntry {
+        std::string fileName;
+        size_t fileEntryHeaderOffset = 0U;
+    };
+
+    std::vector<uint8_t> encodeIndex() const;
+
     std::vector<uint8_t> fileEntries;
+    std::vector<IndexEntry> indexEntries;
     bool padTo8Bytes = false;
+    bool createIndex = false;
     uint32_t paddingEntry = 0U;
 };
 
@@ -19,15 +19,33 @@ bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const
 template <>
 SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const uint8_t> archive, const ConstStringRef requestedProductAbbreviation, const TargetDevice &requestedTargetDevice,
                                                                               std::string &outErrReason, std::string &outWarning) {
+    std::string pointerSize = ((requestedTargetDevice.maxPointerSizeInBytes == 8) ? "64" : "32");
+    std::string filterPointerSizeAndPlatform = pointerSize + "." + requestedProductAbbreviation.str();
+    std::string filterPointerSizeAndPlatformAndStepping = filterPointerSizeAndPlatform + "." + std::to_string(requestedTargetDevice.stepping);
+
+    Ar::ArFileEntryHeaderAndData indexedFiles[2] = {Ar::findIndexedFile(archive, filterPointerSizeAndPlatformAndStepping),
+                                                    Ar::findIndexedFile(archive, filterPointerSizeAndPlatform)};
+    for (auto &indexedFile : indexedFiles) {
+        if (nullptr == indexedFile.fullHeader) {
+            continue;
+        }
+        std::string unpackErrors;
+        std::string unpackWarnings;
+        auto unpacked = unpackSingleDeviceBinary(indexedFile.fileData, requestedProductAbbreviation, requestedTargetDevice, unpackErrors, unpackWarnings);
+        if (false == unpacked.deviceBinary.empty()) {
+            if (&indexedFile != &indexedFiles[0]) {
+                outWarning = "Couldn't find perfectly matched binary (right stepping) in AR, using best usable";
+            }
+            return unpacked;
+        }
+    }
+
+    // archives without index (or without exact name match) require scanning all file entries
     auto archiveData = NEO::Ar::decodeAr(archive, outErrReason, outWarning);
     if (nullptr == archiveData.magic) {
         return {};
     }
 
-    std::string pointerSize = ((requestedTargetDevice.maxPointerSizeInBytes == 8) ? "64" : "32");
-    std::string filterPointerSizeAndPlatform = pointerSize + "." + requestedProductAbbreviation.str();
-    std::string filterPointerSizeAndPlatformAndStepping = filterPointerSizeAndPlatform + "." + std::to_string(requestedTargetDevice.stepping);
-
     Ar::ArFileEntryHeaderAndData *matchedFiles[2] = {};
     Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatformAndStepping = matchedFiles[0]; // best match
     Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatform = matchedFiles[1];
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include <algorithm>
 
@@ -499,6 +500,10 @@ inline bool decodePatchList(PatchTokensStreamReader patchListStream, OutT &out)
     return decodeSuccess;
 }
 
+inline size_t getKernelInfoBlobSize(const SKernelBinaryHeaderCommon &header) {
+    return sizeof(SKernelBinaryHeaderCommon) + header.KernelNameSize + header.KernelHeapSize + header.GeneralStateHeapSize + header.DynamicStateHeapSize + header.SurfaceStateHeapSize + header.PatchListSize;
+}
+
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out) {
     PatchTokensStreamReader stream{kernelBlob};
     auto decodePos = stream.data.begin();
@@ -510,7 +515,7 @@ bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelF
 
     out.header = reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos);
 
-    auto kernelInfoBlobSize = sizeof(SKernelBinaryHeaderCommon) + out.header->KernelNameSize + out.header->KernelHeapSize + out.header->GeneralStateHeapSize + out.header->DynamicStateHeapSize + out.header->SurfaceStateHeapSize + out.header->PatchListSize;
+    auto kernelInfoBlobSize = getKernelInfoBlobSize(*out.header);
 
     if (stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
         out.decodeStatus = DecodeError::InvalidBinary;
@@ -576,14 +581,49 @@ inline bool decodeKernels(ProgramFromPatchtokens &decodedProgram) {
     const uint8_t *decodePos = decodedProgram.blobs.kernelsInfo.begin();
     bool decodeSuccess = true;
     PatchTokensStreamReader stream{decodedProgram.blobs.kernelsInfo};
-    for (uint32_t i = 0; (i < numKernels) && decodeSuccess; i++) {
-        decodedProgram.kernels.resize(decodedProgram.kernels.size() + 1);
-        auto &currKernelInfo = *decodedProgram.kernels.rbegin();
+
+    auto decodeThreadsCount = getKernelsDecodeThreadsCount(numKernels);
+    if (decodeThreadsCount <= 1U) {
+        for (uint32_t i = 0; (i < numKernels) && decodeSuccess; i++) {
+            decodedProgram.kernels.resize(decodedProgram.kernels.size() + 1);
+            auto &currKernelInfo = *decodedProgram.kernels.rbegin();
+            auto kernelDataLeft = ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos));
+            decodeSuccess = decodeKernelFromPatchtokensBlob(kernelDataLeft, currKernelInfo);
+            decodePos = ptrOffset(decodePos, currKernelInfo.blobs.kernelInfo.size());
+        }
+        return decodeSuccess;
+    }
+
+    // kernel blobs are laid out back to back, so kernels can be located using headers only;
+    // kernel with malformed header ends the list and fails in decodeKernelFromPatchtokensBlob
+    std::vector<ArrayRef<const uint8_t>> kernelBlobs;
+    kernelBlobs.reserve(numKernels);
+    for (uint32_t i = 0; i < numKernels; i++) {
         auto kernelDataLeft = ArrayRef<const uint8_t>(decodePos, stream.getDataSizeLeft(decodePos));
-        decodeSuccess = decodeKernelFromPatchtokensBlob(kernelDataLeft, currKernelInfo);
-        decodePos = ptrOffset(decodePos, currKernelInfo.blobs.kernelInfo.size());
+        kernelBlobs.push_back(kernelDataLeft);
+        if (stream.notEnoughDataLeft<SKernelBinaryHeaderCommon>(decodePos)) {
+            break;
+        }
+        auto kernelInfoBlobSize = getKernelInfoBlobSize(*reinterpret_cast<const SKernelBinaryHeaderCommon *>(decodePos));
+        if (stream.notEnoughDataLeft(decodePos, kernelInfoBlobSize)) {
+            break;
+        }
+        decodePos = ptrOffset(decodePos, kernelInfoBlobSize);
     }
-    return decodeSuccess;
+
+    decodedProgram.kernels.resize(kernelBlobs.size());
+    parallelFor(kernelBlobs.size(), decodeThreadsCount, [&](size_t kernelId) {
+        decodeKernelFromPatchtokensBlob(kernelBlobs[kernelId], decodedProgram.kernels[kernelId]);
+    });
+
+    // match serial decoding - kernels following the first invalid one are not decoded
+    for (size_t kernelId = 0; kernelId < decodedProgram.kernels.size(); ++kernelId) {
+        if (decodedProgram.kernels[kernelId].decodeStatus != DecodeError::Success) {
+            decodedProgram.kernels.resize(kernelId + 1);
+            return false;
+        }
+    }
+    return true;
 }
 
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out) {
@@ -596,6 +636,10 @@ bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, Progr
     return decodeSuccess;
 }
 
+size_t getKernelsDecodeThreadsCount(size_t kernelsCount) {
+    return getParallelThreadsCount(kernelsCount, minKernelsPerDecodeThread, DebugManager.flags.PatchTokensDecodeThreads.get());
+}
+
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob) {
     UNRECOVERABLE_IF(kernelBlob.size() <= sizeof(SKernelBinaryHeaderCommon));
     auto dataToHash = ArrayRef<const uint8_t>(ptrOffset(kernelBlob.begin(), sizeof(SKernelBinaryHeaderCommon)), kernelBlob.end());
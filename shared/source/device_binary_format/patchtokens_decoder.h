@@ -192,6 +192,11 @@ struct KernelArgAttributesFromPatchtokens {
     ArrayRef<const char> typeQualifiers;
 };
 
+constexpr size_t minKernelsPerDecodeThread = 64U;
+
+// number of threads decoding, validating and populating kernels of a single program, see PatchTokensDecodeThreads
+size_t getKernelsDecodeThreadsCount(size_t kernelsCount);
+
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out);
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out);
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob);
@@ -16,6 +16,7 @@
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/parallel_for.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/program/kernel_info.h"
@@ -750,10 +751,25 @@ NEO::DecodeError populateKernelDescriptor(const NEO::Elf::ZebinKernelMetadata::T
     return DecodeError::Success;
 }
 
-NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
-                                          NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning) {
-    auto kernelInfo = std::make_unique<NEO::KernelInfo>();
-    auto &kernelDescriptor = kernelInfo->kernelDescriptor;
+ZebinTextSectionsByKernelName mapTextSectionsByKernelName(NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections) {
+    ZebinTextSectionsByKernelName textSections;
+    if (zebinSections.textKernelSections.empty()) {
+        return textSections;
+    }
+    textSections.reserve(zebinSections.textKernelSections.size());
+    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+    for (auto *textSection : zebinSections.textKernelSections) {
+        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
+        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+        textSections[sufix.str()] = textSection;
+    }
+    return textSections;
+}
+
+NEO::DecodeError populateKernelDescriptor(NEO::KernelInfo &dst, const ZebinTextSectionsByKernelName &textSections,
+                                          const NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning) {
+    auto &kernelDescriptor = dst.kernelDescriptor;
 
     ZeInfoKernelSections zeInfokernelSections;
     extractZeInfoKernelSections(yamlParser, kernelNd, zeInfokernelSections, NEO::Elf::SectionsNamesZebin::zeInfo, outWarning);
@@ -765,7 +781,7 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
     kernelDescriptor.kernelMetadata.kernelName = yamlParser.readValueNoQuotes(*zeInfokernelSections.nameNd[0]).str();
 
     NEO::Elf::ZebinKernelMetadata::Types::Kernel::ExecutionEnv::ExecutionEnvBaseT execEnv;
-    auto execEnvErr = readZeInfoExecutionEnvironment(yamlParser, *zeInfokernelSections.executionEnvNd[0], execEnv, kernelInfo->kernelDescriptor.kernelMetadata.kernelName, outErrReason, outWarning);
+    auto execEnvErr = readZeInfoExecutionEnvironment(yamlParser, *zeInfokernelSections.executionEnvNd[0], execEnv, kernelDescriptor.kernelMetadata.kernelName, outErrReason, outWarning);
     if (DecodeError::Success != execEnvErr) {
         return execEnvErr;
     }
@@ -872,7 +888,7 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
         static constexpr auto btiSize = sizeof(int);
         auto numEntries = maximumBindingTableEntry.btiValue + 1;
         kernelDescriptor.generatedHeaps.resize(alignUp(generatedSshPos, maxSurfaceStateSize), 0U);
-        generatedSshPos = kernelInfo->kernelDescriptor.generatedHeaps.size();
+        generatedSshPos = kernelDescriptor.generatedHeaps.size();
 
         // make room for surface states
         kernelDescriptor.generatedHeaps.resize(generatedSshPos + numEntries * maxSurfaceStateSize, 0U);
@@ -905,27 +921,28 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
         kernelDescriptor.payloadMappings.bindingTable.tableOffset = static_cast<SurfaceStateHeapOffset>(generatedBindingTablePos - generatedSshPos);
     }
 
-    ZebinSections::SectionHeaderData *correspondingTextSegment = nullptr;
-    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
-    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *textSection : zebinSections.textKernelSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-        if (sufix == kernelDescriptor.kernelMetadata.kernelName) {
-            correspondingTextSegment = textSection;
-        }
-    }
-
-    if (nullptr == correspondingTextSegment) {
+    auto textSectionIt = textSections.find(kernelDescriptor.kernelMetadata.kernelName);
+    if (textSections.end() == textSectionIt) {
         outErrReason.append("DeviceBinaryFormat::Zebin : Could not find text section for kernel " + kernelDescriptor.kernelMetadata.kernelName + "\n");
         return DecodeError::InvalidBinary;
     }
 
-    kernelInfo->heapInfo.pKernelHeap = correspondingTextSegment->data.begin();
-    kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
-    kernelInfo->heapInfo.KernelUnpaddedSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
-    kernelInfo->heapInfo.pSsh = kernelDescriptor.generatedHeaps.data() + generatedSshPos;
-    kernelInfo->heapInfo.SurfaceStateHeapSize = generatedSshSize;
+    auto correspondingTextSegment = textSectionIt->second;
+    dst.heapInfo.pKernelHeap = correspondingTextSegment->data.begin();
+    dst.heapInfo.KernelHeapSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
+    dst.heapInfo.KernelUnpaddedSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
+    dst.heapInfo.pSsh = kernelDescriptor.generatedHeaps.data() + generatedSshPos;
+    dst.heapInfo.SurfaceStateHeapSize = generatedSshSize;
+    return DecodeError::Success;
+}
+
+NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
+                                          NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning) {
+    auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+    auto decodeErr = populateKernelDescriptor(*kernelInfo, mapTextSectionsByKernelName(elf, zebinSections), yamlParser, kernelNd, outErrReason, outWarning);
+    if (DecodeError::Success != decodeErr) {
+        return decodeErr;
+    }
     dst.kernelInfos.push_back(kernelInfo.release());
     return DecodeError::Success;
 }
@@ -950,6 +967,21 @@ NEO::DecodeError populateZeInfoVersion(NEO::Elf::ZebinKernelMetadata::Types::Ver
     return NEO::DecodeError::Success;
 }
 
+namespace {
+struct KernelDecodeResult {
+    std::unique_ptr<NEO::KernelInfo> kernelInfo;
+    DecodeError error = DecodeError::Success;
+    std::string errReason;
+    std::string warning;
+};
+
+constexpr size_t minKernelsPerDecodeThread = 64U;
+
+size_t getKernelDecodeThreadsCount(size_t kernelsCount) {
+    return getParallelThreadsCount(kernelsCount, minKernelsPerDecodeThread, NEO::DebugManager.flags.ZebinDecodeThreads.get());
+}
+} // namespace
+
 template <>
 DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
     auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(src.deviceBinary, outErrReason, outWarning);
@@ -1055,11 +1087,40 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo
         return DecodeError::Success;
     }
 
+    auto textSections = mapTextSectionsByKernelName(elf, zebinSections);
+    std::vector<const NEO::Yaml::Node *> kernelNodes;
     for (const auto &kernelNd : yamlParser.createChildrenRange(*kernelsSectionNodes[0])) {
-        auto zeInfoErr = populateKernelDescriptor(dst, elf, zebinSections, yamlParser, kernelNd, outErrReason, outWarning);
-        if (DecodeError::Success != zeInfoErr) {
-            return zeInfoErr;
+        kernelNodes.push_back(&kernelNd);
+    }
+
+    auto decodeThreadsCount = getKernelDecodeThreadsCount(kernelNodes.size());
+    if (decodeThreadsCount <= 1U) {
+        for (auto kernelNd : kernelNodes) {
+            auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+            auto zeInfoErr = populateKernelDescriptor(*kernelInfo, textSections, yamlParser, *kernelNd, outErrReason, outWarning);
+            if (DecodeError::Success != zeInfoErr) {
+                return zeInfoErr;
+            }
+            dst.kernelInfos.push_back(kernelInfo.release());
+        }
+        return DecodeError::Success;
+    }
+
+    // kernels are independent of each other, results are merged in kernel order so that output matches serial decoding
+    std::vector<KernelDecodeResult> results(kernelNodes.size());
+    parallelFor(kernelNodes.size(), decodeThreadsCount, [&](size_t kernelId) {
+        auto &result = results[kernelId];
+        result.kernelInfo = std::make_unique<NEO::KernelInfo>();
+        result.error = populateKernelDescriptor(*result.kernelInfo, textSections, yamlParser, *kernelNodes[kernelId], result.errReason, result.warning);
+    });
+
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::Success != result.error) {
+            outErrReason.append(result.errReason);
+            return result.error;
         }
+        dst.kernelInfos.push_back(result.kernelInfo.release());
     }
 
     return DecodeError::Success;
@@ -15,8 +15,10 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
+struct KernelInfo;
 
 static constexpr NEO::Elf::ZebinKernelMetadata::Types::Version zeInfoDecoderVersion{1, 0};
 
@@ -91,6 +93,12 @@ NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Type
 NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Types::Kernel::PayloadArgument::PayloadArgumentBaseT &src, NEO::KernelDescriptor &dst, uint32_t &crossThreadDataSize,
                                        std::string &outErrReason, std::string &outWarning);
 
+using ZebinTextSectionsByKernelName = std::unordered_map<std::string, ZebinSections::SectionHeaderData *>;
+ZebinTextSectionsByKernelName mapTextSectionsByKernelName(NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections);
+
+NEO::DecodeError populateKernelDescriptor(NEO::KernelInfo &dst, const ZebinTextSectionsByKernelName &textSections,
+                                          const NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning);
+
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning);
 
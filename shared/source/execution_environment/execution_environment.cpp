@@ -8,6 +8,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/compiler_interface/compiler_build_pool.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -18,6 +19,7 @@ namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() = default;
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    compilerBuildPool.reset();
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -55,6 +57,14 @@ bool ExecutionEnvironment::initializeMemoryManager() {
     return memoryManager->isInitialized();
 }
 
+CompilerBuildPool *ExecutionEnvironment::getCompilerBuildPool() {
+    std::lock_guard<std::mutex> lock(compilerBuildPoolMtx);
+    if (nullptr == compilerBuildPool) {
+        compilerBuildPool = std::make_unique<CompilerBuildPool>(CompilerBuildPool::getDefaultThreadsCount());
+    }
+    return compilerBuildPool.get();
+}
+
 void ExecutionEnvironment::calculateMaxOsContextCount() {
     MemoryManager::maxOsContextCount = 0u;
     for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -8,9 +8,12 @@
 #pragma once
 #include "shared/source/utilities/reference_tracked_object.h"
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
+class CompilerBuildPool;
 class MemoryManager;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
@@ -28,6 +31,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
         debuggingEnabled = true;
     }
     bool isDebuggingEnabled() { return debuggingEnabled; }
+    CompilerBuildPool *getCompilerBuildPool();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<OsEnvironment> osEnvironment;
@@ -35,5 +39,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
   protected:
     bool debuggingEnabled = false;
+    std::mutex compilerBuildPoolMtx;
+    std::unique_ptr<CompilerBuildPool> compilerBuildPool;
 };
 } // namespace NEO
@@ -7,15 +7,46 @@
 
 #include "shared/source/helpers/blit_commands_helper.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/surface.h"
 
 namespace NEO {
 
 namespace BlitHelperFunctions {
 BlitMemoryToAllocationFunc blitMemoryToAllocation = BlitHelper::blitMemoryToAllocation;
+BlitMemoryToAllocationsFunc blitMemoryToAllocations = BlitHelper::blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
+BlitOperationResult BlitHelper::blitMemoryToAllocations(const Device &device, const std::vector<MemoryTransfer> &transfers) {
+    auto &hwInfo = device.getHardwareInfo();
+    if (!hwInfo.capabilityTable.blitterOperationsSupported) {
+        return BlitOperationResult::Unsupported;
+    }
+    if (transfers.empty()) {
+        return BlitOperationResult::Success;
+    }
+
+    auto blitDevice = device.getDeviceById(0);
+    auto &bcsEngine = blitDevice->getEngine(EngineHelpers::getBcsEngineType(hwInfo, blitDevice->getSelectorCopyEngine()), false, false);
+    auto bcsCsr = bcsEngine.commandStreamReceiver;
+
+    BlitPropertiesContainer blitPropertiesContainer;
+    for (auto &transfer : transfers) {
+        blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForReadWriteBuffer(BlitterConstants::BlitDirection::HostPtrToBuffer,
+                                                                                               *bcsCsr, transfer.dstAllocation, nullptr, transfer.srcMemory,
+                                                                                               transfer.dstAllocation->getGpuAddress(), 0, 0,
+                                                                                               {transfer.dstOffset, 0, 0}, {transfer.srcSize, 1, 1}, 0, 0, 0, 0));
+    }
+    bcsCsr->blitBuffer(blitPropertiesContainer, true, false);
+
+    return BlitOperationResult::Success;
+}
+
 BlitProperties BlitProperties::constructPropertiesForReadWriteBuffer(BlitterConstants::BlitDirection blitDirection,
                                                                      CommandStreamReceiver &commandStreamReceiver,
                                                                      GraphicsAllocation *memObjAllocation,
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -30,6 +31,7 @@ struct TagNode;
 
 struct BlitProperties;
 struct HardwareInfo;
+struct MemoryTransfer;
 struct TimestampPacketDependencies;
 using BlitPropertiesContainer = StackVec<BlitProperties, 16>;
 
@@ -93,6 +95,9 @@ using BlitMemoryToAllocationFunc = std::function<BlitOperationResult(const Devic
                                                                      Vec3<size_t> size)>;
 extern BlitMemoryToAllocationFunc blitMemoryToAllocation;
 extern BlitMemoryToAllocationFunc blitAllocationToMemory;
+using BlitMemoryToAllocationsFunc = std::function<BlitOperationResult(const Device &device,
+                                                                      const std::vector<MemoryTransfer> &transfers)>;
+extern BlitMemoryToAllocationsFunc blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
 struct BlitHelper {
@@ -100,6 +105,8 @@ struct BlitHelper {
                                                       Vec3<size_t> size);
     static BlitOperationResult blitAllocationToMemory(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                       Vec3<size_t> size);
+    // all transfers are dispatched into one BCS submission, flushed and waited for once
+    static BlitOperationResult blitMemoryToAllocations(const Device &device, const std::vector<MemoryTransfer> &transfers);
 };
 
 template <typename GfxFamily>
@@ -19,7 +19,7 @@ DeferrableAllocationDeletion::DeferrableAllocationDeletion(MemoryManager &memory
 bool DeferrableAllocationDeletion::apply() {
     if (graphicsAllocation.isUsed()) {
         bool isStillUsed = false;
-        for (auto &engine : memoryManager.getRegisteredEngines()) {
+        for (auto &engine : memoryManager.getRegisteredEnginesSnapshot()) {
             auto contextId = engine.osContext->getContextId();
             if (graphicsAllocation.isUsedByOsContext(contextId)) {
                 auto currentContextTaskCount = *engine.commandStreamReceiver->getTagAddress();
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/isa_heap_allocator.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+IsaHeapAllocator::IsaHeapAllocator(Device &device) : device(device) {
+}
+
+IsaHeapAllocator::~IsaHeapAllocator() {
+    auto memoryManager = device.getMemoryManager();
+    for (auto &arena : arenas) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(arena->allocation);
+    }
+}
+
+GraphicsAllocation *IsaHeapAllocator::allocate(size_t size, size_t &offsetInArena) {
+    if ((size == 0U) || (size > maxChunkSize)) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    reclaimPendingChunks();
+
+    for (auto &arena : arenas) {
+        if (allocateFromArena(*arena, size, offsetInArena)) {
+            return arena->allocation;
+        }
+    }
+
+    auto allocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(), arenaSize,
+                                                                                       GraphicsAllocation::AllocationType::KERNEL_ISA,
+                                                                                       device.getDeviceBitfield()});
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+    auto arena = std::make_unique<Arena>();
+    arena->allocation = allocation;
+    arena->heap = std::make_unique<HeapAllocator>(heapBase, arenaSize, arenaSize, chunkAlignment);
+    auto success = allocateFromArena(*arena, size, offsetInArena);
+    UNRECOVERABLE_IF(!success);
+    arenas.push_back(std::move(arena));
+    return allocation;
+}
+
+void IsaHeapAllocator::free(GraphicsAllocation *arenaAllocation, size_t offsetInArena) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto arena = getArena(arenaAllocation);
+    UNRECOVERABLE_IF(arena == nullptr);
+
+    PendingChunk chunk;
+    chunk.arena = arena;
+    chunk.offset = offsetInArena;
+    if (arenaAllocation->isUsed()) {
+        for (auto &engine : device.getMemoryManager()->getRegisteredEnginesSnapshot()) {
+            auto contextId = engine.osContext->getContextId();
+            if (arenaAllocation->isUsedByOsContext(contextId)) {
+                chunk.contextTaskCounts.emplace_back(contextId, arenaAllocation->getTaskCount(contextId));
+            }
+        }
+    }
+
+    if (isChunkInUse(chunk)) {
+        pendingChunks.push_back(chunk);
+    } else {
+        releaseChunk(*arena, offsetInArena);
+    }
+}
+
+bool IsaHeapAllocator::isArenaAllocation(const GraphicsAllocation *allocation) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return getArena(allocation) != nullptr;
+}
+
+size_t IsaHeapAllocator::getArenasCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return arenas.size();
+}
+
+IsaHeapAllocator::Arena *IsaHeapAllocator::getArena(const GraphicsAllocation *allocation) const {
+    for (auto &arena : arenas) {
+        if (arena->allocation == allocation) {
+            return arena.get();
+        }
+    }
+    return nullptr;
+}
+
+bool IsaHeapAllocator::allocateFromArena(Arena &arena, size_t size, size_t &offsetInArena) {
+    size_t chunkSize = size;
+    auto chunkAddress = arena.heap->allocate(chunkSize);
+    if (chunkAddress == 0llu) {
+        return false;
+    }
+    offsetInArena = static_cast<size_t>(chunkAddress - heapBase);
+    arena.chunkSizes[offsetInArena] = chunkSize;
+    return true;
+}
+
+bool IsaHeapAllocator::isChunkInUse(const PendingChunk &chunk) const {
+    for (auto &engine : device.getMemoryManager()->getRegisteredEnginesSnapshot()) {
+        auto contextId = engine.osContext->getContextId();
+        for (auto &contextTaskCount : chunk.contextTaskCounts) {
+            if ((contextTaskCount.first == contextId) &&
+                (contextTaskCount.second > *engine.commandStreamReceiver->getTagAddress())) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void IsaHeapAllocator::releaseChunk(Arena &arena, size_t offset) {
+    auto chunkSize = arena.chunkSizes.find(offset);
+    UNRECOVERABLE_IF(chunkSize == arena.chunkSizes.end());
+    arena.heap->free(heapBase + offset, chunkSize->second);
+    arena.chunkSizes.erase(chunkSize);
+}
+
+void IsaHeapAllocator::reclaimPendingChunks() {
+    auto firstInUse = std::partition(pendingChunks.begin(), pendingChunks.end(), [this](const PendingChunk &chunk) {
+        return !isChunkInUse(chunk);
+    });
+    for (auto chunk = pendingChunks.begin(); chunk != firstInUse; chunk++) {
+        releaseChunk(*chunk->arena, chunk->offset);
+    }
+    pendingChunks.erase(pendingChunks.begin(), firstInUse);
+}
+} // namespace NEO
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class Device;
+class GraphicsAllocation;
+
+// Packs ISA of many kernels into a few large KERNEL_ISA allocations (arenas) of a device,
+// so that residency and submissions track arenas instead of one allocation per kernel.
+// Chunks freed while the arena may still be in use by GPU are reclaimed once the owning contexts complete.
+class IsaHeapAllocator : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t arenaSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t maxChunkSize = arenaSize / 4;
+    static constexpr size_t chunkAlignment = MemoryConstants::cacheLineSize;
+
+    IsaHeapAllocator(Device &device);
+    ~IsaHeapAllocator();
+
+    // returns arena containing the chunk or nullptr when size can't be sub-allocated
+    GraphicsAllocation *allocate(size_t size, size_t &offsetInArena);
+    void free(GraphicsAllocation *arenaAllocation, size_t offsetInArena);
+    bool isArenaAllocation(const GraphicsAllocation *allocation) const;
+    size_t getArenasCount() const;
+
+  protected:
+    struct Arena {
+        GraphicsAllocation *allocation = nullptr;
+        std::unique_ptr<HeapAllocator> heap;
+        std::unordered_map<size_t, size_t> chunkSizes;
+    };
+
+    struct PendingChunk {
+        Arena *arena = nullptr;
+        size_t offset = 0U;
+        std::vector<std::pair<uint32_t, uint32_t>> contextTaskCounts;
+    };
+
+    static constexpr uint64_t heapBase = MemoryConstants::pageSize;
+
+    Arena *getArena(const GraphicsAllocation *allocation) const;
+    bool allocateFromArena(Arena &arena, size_t size, size_t &offsetInArena);
+    bool isChunkInUse(const PendingChunk &chunk) const;
+    void releaseChunk(Arena &arena, size_t offset);
+    void reclaimPendingChunks();
+
+    Device &device;
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Arena>> arenas;
+    std::vector<PendingChunk> pendingChunks;
+};
+} // namespace NEO
@@ -206,7 +206,7 @@ void MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocatio
             multiContextResourceDestructor->drain(false);
             return;
         }
-        for (auto &engine : getRegisteredEngines()) {
+        for (auto &engine : getRegisteredEnginesSnapshot()) {
             auto osContextId = engine.osContext->getContextId();
             auto allocationTaskCount = gfxAllocation->getTaskCount(osContextId);
             if (gfxAllocation->isUsedByOsContext(osContextId) &&
@@ -245,6 +245,7 @@ bool MemoryManager::isMemoryBudgetExhausted() const {
 OsContext *MemoryManager::createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                                      DeviceBitfield deviceBitfield, PreemptionMode preemptionMode,
                                                      bool lowPriority, bool internalEngine, bool rootDevice) {
+    auto lock = obtainRegisteredEnginesLock();
     auto contextId = ++latestContextId;
     auto osContext = OsContext::create(peekExecutionEnvironment().rootDeviceEnvironments[commandStreamReceiver->getRootDeviceIndex()]->osInterface.get(),
                                        contextId, deviceBitfield, engineType, preemptionMode,
@@ -520,7 +521,13 @@ EngineControlContainer &MemoryManager::getRegisteredEngines() {
     return registeredEngines;
 }
 
+EngineControlSnapshot MemoryManager::getRegisteredEnginesSnapshot() const {
+    auto lock = obtainRegisteredEnginesLock();
+    return EngineControlSnapshot(registeredEngines.begin(), registeredEngines.end());
+}
+
 EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    auto lock = obtainRegisteredEnginesLock();
     EngineControl *engineCtrl = nullptr;
     for (auto &engine : registeredEngines) {
         if (engine.commandStreamReceiver == commandStreamReceiver) {
@@ -532,6 +539,7 @@ EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *c
 }
 
 void MemoryManager::unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    auto lock = obtainRegisteredEnginesLock();
     auto numRegisteredEngines = registeredEngines.size();
     for (auto i = 0u; i < numRegisteredEngines; i++) {
         if (registeredEngines[i].commandStreamReceiver == commandStreamReceiver) {
@@ -543,6 +551,13 @@ void MemoryManager::unregisterEngineForCsr(CommandStreamReceiver *commandStreamR
     }
 }
 
+void MemoryManager::sortRegisteredEnginesByRootDeviceIndex() {
+    auto lock = obtainRegisteredEnginesLock();
+    std::stable_sort(registeredEngines.begin(), registeredEngines.end(), [](const EngineControl &lhs, const EngineControl &rhs) {
+        return lhs.commandStreamReceiver->getRootDeviceIndex() < rhs.commandStreamReceiver->getRootDeviceIndex();
+    });
+}
+
 void *MemoryManager::lockResource(GraphicsAllocation *graphicsAllocation) {
     if (!graphicsAllocation) {
         return nullptr;
@@ -596,7 +611,7 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
 }
 
 void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation) {
-    for (auto &engine : getRegisteredEngines()) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         auto osContextId = engine.osContext->getContextId();
         auto allocationTaskCount = graphicsAllocation.getTaskCount(osContextId);
         if (graphicsAllocation.isUsedByOsContext(osContextId) &&
@@ -607,7 +622,7 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
 }
 
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
-    for (auto &engine : getRegisteredEngines()) {
+    for (auto &engine : getRegisteredEnginesSnapshot()) {
         auto csr = engine.commandStreamReceiver;
         if (waitForCompletion) {
             csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount());
@@ -747,4 +762,19 @@ bool MemoryTransferHelper::transferMemoryToAllocation(bool useBlitter, const Dev
         return device.getMemoryManager()->copyMemoryToAllocation(dstAllocation, dstOffset, srcMemory, srcSize);
     }
 }
+
+bool MemoryTransferHelper::transferMemoryToAllocations(const Device &device, const MemoryTransfers &transfers) {
+    MemoryTransfers blitTransfers;
+    for (auto &transfer : transfers) {
+        if (transfer.useBlitter) {
+            blitTransfers.push_back(transfer);
+        } else if (!device.getMemoryManager()->copyMemoryToAllocation(transfer.dstAllocation, transfer.dstOffset, transfer.srcMemory, transfer.srcSize)) {
+            return false;
+        }
+    }
+    if (blitTransfers.empty()) {
+        return true;
+    }
+    return (BlitHelperFunctions::blitMemoryToAllocations(device, blitTransfers) == BlitOperationResult::Success);
+}
 } // namespace NEO
@@ -20,6 +20,7 @@
 #include "shared/source/memory_manager/local_memory_usage.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "engine_node.h"
 
@@ -51,8 +52,20 @@ struct AddressRange {
 
 constexpr size_t paddingBufferSize = 2 * MemoryConstants::megaByte;
 
+struct MemoryTransfer {
+    GraphicsAllocation *dstAllocation = nullptr;
+    size_t dstOffset = 0U;
+    const void *srcMemory = nullptr;
+    size_t srcSize = 0U;
+    bool useBlitter = false;
+};
+using MemoryTransfers = std::vector<MemoryTransfer>;
+using EngineControlSnapshot = StackVec<EngineControl, 32>;
+
 namespace MemoryTransferHelper {
 bool transferMemoryToAllocation(bool useBlitter, const Device &device, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory, size_t srcSize);
+// all transfers requiring blitter are submitted as one batch, remaining ones are copied by CPU
+bool transferMemoryToAllocations(const Device &device, const MemoryTransfers &transfers);
 }
 
 class MemoryManager {
@@ -168,12 +181,30 @@ class MemoryManager {
     OsContext *createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                           DeviceBitfield deviceBitfield, PreemptionMode preemptionMode,
                                           bool lowPriority, bool internalEngine, bool rootDevice);
-    uint32_t getRegisteredEnginesCount() const { return static_cast<uint32_t>(registeredEngines.size()); }
+    uint32_t getRegisteredEnginesCount() const {
+        auto lock = obtainRegisteredEnginesLock();
+        return static_cast<uint32_t>(registeredEngines.size());
+    }
     EngineControlContainer &getRegisteredEngines();
+    // engines may be registered by other threads while root devices are created in parallel,
+    // iterate over a copy when calling into code that takes other locks
+    EngineControlSnapshot getRegisteredEnginesSnapshot() const;
+    std::unique_lock<std::recursive_mutex> obtainRegisteredEnginesLock() const {
+        return std::unique_lock<std::recursive_mutex>(registeredEnginesMutex);
+    }
     EngineControl *getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     void unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
+    // restores registration order of sequential device creation
+    void sortRegisteredEnginesByRootDeviceIndex();
     HostPtrManager *getHostPtrManager() const { return hostPtrManager.get(); }
-    void setDefaultEngineIndex(uint32_t index) { defaultEngineIndex = index; }
+    void setDefaultEngineIndex(uint32_t index) {
+        auto lock = obtainRegisteredEnginesLock();
+        defaultEngineIndex = index;
+    }
+    OsContext *getDefaultEngineOsContext() const {
+        auto lock = obtainRegisteredEnginesLock();
+        return registeredEngines[defaultEngineIndex].osContext;
+    }
     virtual bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy);
     HeapIndex selectHeap(const GraphicsAllocation *allocation, bool hasPointer, bool isFullRangeSVM, bool useFrontWindow);
     static std::unique_ptr<MemoryManager> createMemoryManager(ExecutionEnvironment &executionEnvironment);
@@ -235,6 +266,7 @@ class MemoryManager {
     EngineControlContainer registeredEngines;
     std::unique_ptr<HostPtrManager> hostPtrManager;
     uint32_t latestContextId = std::numeric_limits<uint32_t>::max();
+    mutable std::recursive_mutex registeredEnginesMutex;
     uint32_t defaultEngineIndex = 0;
     std::unique_ptr<DeferredDeleter> multiContextResourceDestructor;
     std::vector<std::unique_ptr<GfxPartition>> gfxPartitions;
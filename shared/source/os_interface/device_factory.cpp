@@ -11,11 +11,14 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device/root_device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/os_thread.h"
 
 #include "hw_device_id.h"
 
@@ -135,7 +138,12 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
         return devices;
     }
 
-    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); rootDeviceIndex++) {
+    auto numRootDevices = static_cast<uint32_t>(executionEnvironment.rootDeviceEnvironments.size());
+    if (DebugManager.flags.EnableParallelRootDeviceInitialization.get() && numRootDevices > 1) {
+        return createRootDevicesInParallel(executionEnvironment, numRootDevices);
+    }
+
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
         auto device = createRootDeviceFunc(executionEnvironment, rootDeviceIndex);
         if (device) {
             devices.push_back(std::move(device));
@@ -144,6 +152,49 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
     return devices;
 }
 
+namespace {
+struct RootDeviceCreationArgs {
+    ExecutionEnvironment *executionEnvironment;
+    uint32_t rootDeviceIndex;
+    std::unique_ptr<Device> device;
+};
+
+void *createRootDeviceOnThread(void *arg) {
+    auto args = reinterpret_cast<RootDeviceCreationArgs *>(arg);
+    args->device = DeviceFactory::createRootDeviceFunc(*args->executionEnvironment, args->rootDeviceIndex);
+    return nullptr;
+}
+} // namespace
+
+std::vector<std::unique_ptr<Device>> DeviceFactory::createRootDevicesInParallel(ExecutionEnvironment &executionEnvironment, uint32_t numRootDevices) {
+    auto memoryManager = executionEnvironment.memoryManager.get();
+    std::vector<RootDeviceCreationArgs> creationArgs(numRootDevices);
+    std::vector<std::unique_ptr<Thread>> workers;
+    workers.reserve(numRootDevices);
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        creationArgs[rootDeviceIndex].executionEnvironment = &executionEnvironment;
+        creationArgs[rootDeviceIndex].rootDeviceIndex = rootDeviceIndex;
+        workers.push_back(Thread::create(createRootDeviceOnThread, &creationArgs[rootDeviceIndex]));
+    }
+    for (auto &worker : workers) {
+        worker->join();
+    }
+
+    // engines got registered in arbitrary order, make the memory manager state match sequential creation
+    memoryManager->sortRegisteredEnginesByRootDeviceIndex();
+
+    std::vector<std::unique_ptr<Device>> devices;
+    for (auto &args : creationArgs) {
+        if (args.device) {
+            devices.push_back(std::move(args.device));
+        }
+    }
+    if (!devices.empty()) {
+        memoryManager->setDefaultEngineIndex(devices.back()->getDefaultEngineIndex());
+    }
+    return devices;
+}
+
 std::unique_ptr<Device> (*DeviceFactory::createRootDeviceFunc)(ExecutionEnvironment &, uint32_t) = [](ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) -> std::unique_ptr<Device> {
     return std::unique_ptr<Device>(Device::create<RootDevice>(&executionEnvironment, rootDeviceIndex));
 };
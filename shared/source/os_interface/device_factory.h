@@ -20,6 +20,7 @@ class DeviceFactory {
     static bool prepareDeviceEnvironments(ExecutionEnvironment &executionEnvironment);
     static bool prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment);
     static std::vector<std::unique_ptr<Device>> createDevices(ExecutionEnvironment &executionEnvironment);
+    static std::vector<std::unique_ptr<Device>> createRootDevicesInParallel(ExecutionEnvironment &executionEnvironment, uint32_t numRootDevices);
     static bool isHwModeSelected();
 
     static std::unique_ptr<Device> (*createRootDeviceFunc)(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
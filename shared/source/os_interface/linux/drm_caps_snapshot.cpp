@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_caps_snapshot.h"
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+
+#include "driver_version.h"
+#include "os_inc.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#define QTR(a) #a
+#define TOSTR(b) QTR(b)
+
+namespace NEO {
+
+DrmCapsSnapshotCache::DrmCapsSnapshotCache(const std::string &cacheDir, int deviceId, int revisionId, const std::string &pciPath) {
+    key = computeKey(deviceId, revisionId, pciPath, getKernelBuild(), getDriverBuild());
+
+    std::stringstream stream;
+    stream << cacheDir << PATH_SEPARATOR << "drm_caps_"
+           << std::setfill('0') << std::setw(sizeof(key) * 2) << std::hex << key
+           << ".bin";
+    fileName = stream.str();
+}
+
+uint64_t DrmCapsSnapshotCache::computeKey(int deviceId, int revisionId, const std::string &pciPath, const std::string &kernelBuild, const std::string &driverBuild) {
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(&deviceId), sizeof(deviceId));
+    hash.update(reinterpret_cast<const char *>(&revisionId), sizeof(revisionId));
+    hash.update("----", 4);
+    hash.update(pciPath.c_str(), pciPath.size());
+    hash.update("----", 4);
+    hash.update(kernelBuild.c_str(), kernelBuild.size());
+    hash.update("----", 4);
+    hash.update(driverBuild.c_str(), driverBuild.size());
+    return hash.finish();
+}
+
+std::string DrmCapsSnapshotCache::getKernelBuild() {
+    struct utsname name = {};
+    if (uname(&name) != 0) {
+        return {};
+    }
+    return std::string(name.release) + " " + name.version;
+}
+
+std::string DrmCapsSnapshotCache::getDriverBuild() {
+#ifdef NEO_OCL_DRIVER_VERSION
+    return TOSTR(NEO_OCL_DRIVER_VERSION);
+#else
+    return {};
+#endif
+}
+
+bool DrmCapsSnapshotCache::load(DrmCapsSnapshot &snapshot) const {
+    size_t size = 0;
+    auto data = loadDataFromFile(fileName.c_str(), size);
+    if (data == nullptr || size != sizeof(Header) + sizeof(DrmCapsSnapshot)) {
+        return false;
+    }
+
+    Header header = {};
+    memcpy(&header, data.get(), sizeof(Header));
+    if (header.magic != magic ||
+        header.formatVersion != formatVersion ||
+        header.key != key ||
+        header.snapshotSize != sizeof(DrmCapsSnapshot)) {
+        return false;
+    }
+
+    memcpy(&snapshot, data.get() + sizeof(Header), sizeof(DrmCapsSnapshot));
+    return true;
+}
+
+bool DrmCapsSnapshotCache::store(const DrmCapsSnapshot &snapshot) const {
+    char data[sizeof(Header) + sizeof(DrmCapsSnapshot)] = {};
+
+    Header header = {magic, formatVersion, key, sizeof(DrmCapsSnapshot)};
+    memcpy(data, &header, sizeof(Header));
+    memcpy(data + sizeof(Header), &snapshot, sizeof(DrmCapsSnapshot));
+
+    auto tempFileName = fileName + "." + std::to_string(getpid()) + ".tmp";
+    if (writeDataToFile(tempFileName.c_str(), data, sizeof(data)) != sizeof(data)) {
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+    if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+        std::remove(tempFileName.c_str());
+        return false;
+    }
+    return true;
+}
+} // namespace NEO
+
+#undef QTR
+#undef TOSTR
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "drm/i915_drm.h"
+
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+// Raw device capabilities read from the kernel driver (ioctls and sysfs) during Drm initialization.
+// Only values returned by the kernel are kept; everything derived from them is still computed on every start.
+struct DrmCapsSnapshot {
+    struct Param {
+        int32_t queryRet = -1;
+        int32_t value = 0;
+    };
+
+    int32_t topologyQueried = 0;
+    int32_t sliceCount = 0;
+    int32_t subSliceCount = 0;
+    int32_t euCount = 0;
+    int32_t gttSizeQueryRet = -1;
+    int32_t maxGpuFrequencyQueryRet = -1;
+    uint64_t gttSize = 0;
+    int32_t maxGpuFrequency = 0;
+    Param execSoftPin;
+    Param euTotal;
+    Param subsliceTotal;
+    Param pooledEuEnabled;
+    Param minEuInPool;
+    int32_t sliceCountChangeSupported = 0;
+    int32_t nonPersistentContextsSupported = 0;
+    int32_t preemptionSupported = 0;
+    drm_i915_gem_context_param_sseu sseu = {};
+};
+
+class DrmCapsSnapshotCache {
+  public:
+    static constexpr uint32_t magic = 0x53504344; // "DCPS"
+    static constexpr uint32_t formatVersion = 2;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t formatVersion;
+        uint64_t key;
+        uint64_t snapshotSize;
+    };
+
+    DrmCapsSnapshotCache(const std::string &cacheDir, int deviceId, int revisionId, const std::string &pciPath);
+
+    static uint64_t computeKey(int deviceId, int revisionId, const std::string &pciPath, const std::string &kernelBuild, const std::string &driverBuild);
+    static std::string getKernelBuild();
+    static std::string getDriverBuild();
+
+    const std::string &getFileName() const { return fileName; }
+    uint64_t getKey() const { return key; }
+
+    bool load(DrmCapsSnapshot &snapshot) const;
+    // written to a temporary file first and renamed over the cache file, so readers never see a partial snapshot
+    bool store(const DrmCapsSnapshot &snapshot) const;
+
+  protected:
+    uint64_t key = 0;
+    std::string fileName;
+};
+} // namespace NEO
@@ -111,7 +111,7 @@ void DrmMemoryOperationsHandlerBind::evictUnusedAllocations() {
 }
 
 void DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction) {
-    const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines();
+    const auto engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEnginesSnapshot();
     std::vector<GraphicsAllocation *> evictCandidates;
 
     for (auto subdeviceIndex = 0u; subdeviceIndex < HwHelper::getSubDevicesCount(rootDeviceEnvironment.getHardwareInfo()); subdeviceIndex++) {
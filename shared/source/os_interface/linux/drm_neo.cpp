@@ -280,20 +280,20 @@ int Drm::setupHardwareInfo(DeviceDescriptor *device, bool setupFeatureTableAndWo
     int subSliceTotal;
     int euTotal;
 
-    bool status = queryTopology(sliceTotal, subSliceTotal, euTotal);
+    bool status = queryTopologyCached(sliceTotal, subSliceTotal, euTotal);
 
     if (!status) {
         PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Topology query failed!\n");
 
         sliceTotal = hwInfo->gtSystemInfo.SliceCount;
 
-        ret = getEuTotal(euTotal);
+        ret = getEuTotalCached(euTotal);
         if (ret != 0) {
             PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "FATAL: Cannot query EU total parameter!\n");
             return ret;
         }
 
-        ret = getSubsliceTotal(subSliceTotal);
+        ret = getSubsliceTotalCached(subSliceTotal);
         if (ret != 0) {
             PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "FATAL: Cannot query subslice total parameter!\n");
             return ret;
@@ -518,6 +518,144 @@ std::string Drm::generateUUID() {
     return std::string(buffer, 36);
 }
 
+bool Drm::queryTopologyCached(int &sliceCount, int &subSliceCount, int &euCount) {
+    if (capsSnapshotLoaded) {
+        sliceCount = capsSnapshot.sliceCount;
+        subSliceCount = capsSnapshot.subSliceCount;
+        euCount = capsSnapshot.euCount;
+        return capsSnapshot.topologyQueried != 0;
+    }
+
+    bool status = queryTopology(sliceCount, subSliceCount, euCount);
+    capsSnapshot.topologyQueried = status;
+    if (status) {
+        capsSnapshot.sliceCount = sliceCount;
+        capsSnapshot.subSliceCount = subSliceCount;
+        capsSnapshot.euCount = euCount;
+    }
+    return status;
+}
+
+int Drm::queryGttSizeCached(uint64_t &gttSizeOutput) {
+    if (capsSnapshotLoaded) {
+        if (capsSnapshot.gttSizeQueryRet == 0) {
+            gttSizeOutput = capsSnapshot.gttSize;
+        }
+        return capsSnapshot.gttSizeQueryRet;
+    }
+
+    int ret = queryGttSize(gttSizeOutput);
+    capsSnapshot.gttSizeQueryRet = ret;
+    if (ret == 0) {
+        capsSnapshot.gttSize = gttSizeOutput;
+    }
+    return ret;
+}
+
+int Drm::getMaxGpuFrequencyCached(HardwareInfo &hwInfo, int &maxGpuFrequency) {
+    if (capsSnapshotLoaded) {
+        maxGpuFrequency = capsSnapshot.maxGpuFrequency;
+        return capsSnapshot.maxGpuFrequencyQueryRet;
+    }
+
+    int ret = getMaxGpuFrequency(hwInfo, maxGpuFrequency);
+    capsSnapshot.maxGpuFrequencyQueryRet = ret;
+    capsSnapshot.maxGpuFrequency = maxGpuFrequency;
+    return ret;
+}
+
+int Drm::getParamCached(DrmCapsSnapshot::Param &cachedParam, int &value, int (Drm::*getParam)(int &)) {
+    if (capsSnapshotLoaded) {
+        if (cachedParam.queryRet == 0) {
+            value = cachedParam.value;
+        }
+        return cachedParam.queryRet;
+    }
+
+    int ret = (this->*getParam)(value);
+    cachedParam.queryRet = ret;
+    if (ret == 0) {
+        cachedParam.value = value;
+    }
+    return ret;
+}
+
+int Drm::getExecSoftPinCached(int &execSoftPin) {
+    return getParamCached(capsSnapshot.execSoftPin, execSoftPin, &Drm::getExecSoftPin);
+}
+
+int Drm::getEuTotalCached(int &euTotal) {
+    return getParamCached(capsSnapshot.euTotal, euTotal, &Drm::getEuTotal);
+}
+
+int Drm::getSubsliceTotalCached(int &subsliceTotal) {
+    return getParamCached(capsSnapshot.subsliceTotal, subsliceTotal, &Drm::getSubsliceTotal);
+}
+
+int Drm::getEnabledPooledEuCached(int &enabled) {
+    return getParamCached(capsSnapshot.pooledEuEnabled, enabled, &Drm::getEnabledPooledEu);
+}
+
+int Drm::getMinEuInPoolCached(int &minEUinPool) {
+    return getParamCached(capsSnapshot.minEuInPool, minEUinPool, &Drm::getMinEuInPool);
+}
+
+void Drm::checkQueueSliceSupportCached() {
+    if (capsSnapshotLoaded) {
+        sliceCountChangeSupported = (capsSnapshot.sliceCountChangeSupported != 0);
+        sseu = capsSnapshot.sseu;
+        return;
+    }
+
+    checkQueueSliceSupport();
+    capsSnapshot.sliceCountChangeSupported = sliceCountChangeSupported;
+    capsSnapshot.sseu = sseu;
+}
+
+void Drm::checkNonPersistentContextsSupportCached() {
+    if (capsSnapshotLoaded) {
+        nonPersistentContextsSupported = (capsSnapshot.nonPersistentContextsSupported != 0);
+        return;
+    }
+
+    checkNonPersistentContextsSupport();
+    capsSnapshot.nonPersistentContextsSupported = nonPersistentContextsSupported;
+}
+
+void Drm::checkPreemptionSupportCached() {
+    if (capsSnapshotLoaded) {
+        preemptionSupported = (capsSnapshot.preemptionSupported != 0);
+        return;
+    }
+
+    checkPreemptionSupport();
+    capsSnapshot.preemptionSupported = preemptionSupported;
+}
+
+bool Drm::loadCapsSnapshot() {
+    auto &cacheDir = DebugManager.flags.DrmCapsSnapshotDirectory.get();
+    if (cacheDir == "unk") {
+        return false;
+    }
+
+    DrmCapsSnapshotCache cache(cacheDir, deviceId, revisionId, hwDeviceId->getPciPath());
+    capsSnapshotLoaded = cache.load(capsSnapshot);
+    if (!capsSnapshotLoaded) {
+        capsSnapshot = {};
+    }
+    return capsSnapshotLoaded;
+}
+
+bool Drm::storeCapsSnapshot() {
+    auto &cacheDir = DebugManager.flags.DrmCapsSnapshotDirectory.get();
+    if (cacheDir == "unk" || capsSnapshotLoaded) {
+        return false;
+    }
+
+    DrmCapsSnapshotCache cache(cacheDir, deviceId, revisionId, hwDeviceId->getPciPath());
+    return cache.store(capsSnapshot);
+}
+
 Drm::~Drm() {
     destroyVirtualMemoryAddressSpace();
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/os_interface/linux/drm_caps_snapshot.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/memory_info.h"
@@ -101,6 +102,20 @@ class Drm {
     MOCKABLE_VIRTUAL bool queryEngineInfo();
     MOCKABLE_VIRTUAL bool queryMemoryInfo();
     bool queryTopology(int &sliceCount, int &subSliceCount, int &euCount);
+    bool queryTopologyCached(int &sliceCount, int &subSliceCount, int &euCount);
+    int queryGttSizeCached(uint64_t &gttSizeOutput);
+    int getMaxGpuFrequencyCached(HardwareInfo &hwInfo, int &maxGpuFrequency);
+    int getExecSoftPinCached(int &execSoftPin);
+    int getEuTotalCached(int &euTotal);
+    int getSubsliceTotalCached(int &subsliceTotal);
+    int getEnabledPooledEuCached(int &enabled);
+    int getMinEuInPoolCached(int &minEUinPool);
+    void checkQueueSliceSupportCached();
+    void checkNonPersistentContextsSupportCached();
+    void checkPreemptionSupportCached();
+    bool loadCapsSnapshot();
+    bool storeCapsSnapshot();
+    bool isCapsSnapshotLoaded() const { return capsSnapshotLoaded; }
     bool createVirtualMemoryAddressSpace(uint32_t vmCount);
     void destroyVirtualMemoryAddressSpace();
     uint32_t getVirtualMemoryAddressSpace(uint32_t vmId);
@@ -158,6 +173,7 @@ class Drm {
 
   protected:
     int getQueueSliceCount(drm_i915_gem_context_param_sseu *sseu);
+    int getParamCached(DrmCapsSnapshot::Param &cachedParam, int &value, int (Drm::*getParam)(int &));
     std::string generateUUID();
     bool sliceCountChangeSupported = false;
     drm_i915_gem_context_param_sseu sseu{};
@@ -172,6 +188,8 @@ class Drm {
     GTTYPE eGtType = GTTYPE_UNDEFINED;
     RootDeviceEnvironment &rootDeviceEnvironment;
     uint64_t uuid = 0;
+    DrmCapsSnapshot capsSnapshot;
+    bool capsSnapshotLoaded = false;
 
     Drm(std::unique_ptr<HwDeviceId> hwDeviceIdIn, RootDeviceEnvironment &rootDeviceEnvironment);
     std::unique_ptr<SystemInfo> systemInfo;
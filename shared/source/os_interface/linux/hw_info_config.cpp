@@ -94,21 +94,21 @@ int HwInfoConfig::configureHwInfo(const HardwareInfo *inHwInfo, HardwareInfo *ou
     int subSliceCount;
     int euCount;
 
-    bool status = drm->queryTopology(sliceCount, subSliceCount, euCount);
+    bool status = drm->queryTopologyCached(sliceCount, subSliceCount, euCount);
 
     if (!status) {
         PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Topology query failed!\n");
 
         sliceCount = gtSystemInfo->SliceCount;
 
-        ret = drm->getEuTotal(euCount);
+        ret = drm->getEuTotalCached(euCount);
         if (ret != 0) {
             PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "FATAL: Cannot query EU total parameter!\n");
             *outHwInfo = {};
             return ret;
         }
 
-        ret = drm->getSubsliceTotal(subSliceCount);
+        ret = drm->getSubsliceTotalCached(subSliceCount);
         if (ret != 0) {
             PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "FATAL: Cannot query subslice total parameter!\n");
             *outHwInfo = {};
@@ -124,7 +124,7 @@ int HwInfoConfig::configureHwInfo(const HardwareInfo *inHwInfo, HardwareInfo *ou
     uint64_t gttSizeQuery = 0;
     featureTable->ftrSVM = true;
 
-    ret = drm->queryGttSize(gttSizeQuery);
+    ret = drm->queryGttSizeCached(gttSizeQuery);
 
     if (ret == 0) {
         featureTable->ftrSVM = (gttSizeQuery > MemoryConstants::max64BitAppAddress);
@@ -132,7 +132,7 @@ int HwInfoConfig::configureHwInfo(const HardwareInfo *inHwInfo, HardwareInfo *ou
     }
 
     int maxGpuFreq = 0;
-    drm->getMaxGpuFrequency(*outHwInfo, maxGpuFreq);
+    drm->getMaxGpuFrequencyCached(*outHwInfo, maxGpuFreq);
 
     GTTYPE gtType = drm->getGtType();
     if (gtType == GTTYPE_UNDEFINED) {
@@ -167,9 +167,9 @@ int HwInfoConfig::configureHwInfo(const HardwareInfo *inHwInfo, HardwareInfo *ou
     hwHelper.adjustDefaultEngineType(outHwInfo);
     outHwInfo->capabilityTable.defaultEngineType = getChosenEngineType(*outHwInfo);
 
-    drm->checkQueueSliceSupport();
-    drm->checkNonPersistentContextsSupport();
-    drm->checkPreemptionSupport();
+    drm->checkQueueSliceSupportCached();
+    drm->checkNonPersistentContextsSupportCached();
+    drm->checkPreemptionSupportCached();
     bool preemption = drm->isPreemptionSupported();
     PreemptionHelper::adjustDefaultPreemptionMode(outHwInfo->capabilityTable,
                                                   static_cast<bool>(outHwInfo->featureTable.ftrGpGpuMidThreadLevelPreempt) && preemption,
@@ -185,6 +185,8 @@ int HwInfoConfig::configureHwInfo(const HardwareInfo *inHwInfo, HardwareInfo *ou
     KmdNotifyHelper::overrideFromDebugVariable(DebugManager.flags.OverrideEnableQuickKmdSleepForSporadicWaits.get(), kmdNotifyProperties.enableQuickKmdSleepForSporadicWaits);
     KmdNotifyHelper::overrideFromDebugVariable(DebugManager.flags.OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds.get(), kmdNotifyProperties.delayQuickKmdSleepForSporadicWaitsMicroseconds);
 
+    drm->storeCapsSnapshot();
+
     return 0;
 }
 
@@ -0,0 +1,496 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/program_info_cache.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/program/program_info.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace NEO {
+
+namespace ProgramInfoCache {
+
+namespace {
+constexpr uint64_t invalidOffset = std::numeric_limits<uint64_t>::max();
+
+using EntryPoints = decltype(KernelDescriptor::entryPoints);
+using DispatchTraits = decltype(KernelDescriptor::PayloadMappings::dispatchTraits);
+using BindingTable = decltype(KernelDescriptor::PayloadMappings::bindingTable);
+using SamplerTable = decltype(KernelDescriptor::PayloadMappings::samplerTable);
+using ImplicitArgs = decltype(KernelDescriptor::PayloadMappings::implicitArgs);
+
+struct ImageHeader {
+    uint32_t magic = 0U;
+    uint32_t version = 0U;
+    uint64_t deviceBinaryHash = 0U;
+    uint64_t deviceBinarySize = 0U;
+    uint32_t decoderConfig = 0U;
+    uint32_t kernelsCount = 0U;
+};
+
+struct GlobalSurfaceRecord {
+    uint64_t offsetInDeviceBinary = invalidOffset;
+    uint64_t size = 0U;
+};
+
+struct HeapsRecord {
+    uint64_t kernelHeapOffsetInDeviceBinary = invalidOffset;
+    uint64_t sshOffsetInGeneratedHeaps = invalidOffset;
+    uint32_t kernelHeapSize = 0U;
+    uint32_t kernelUnpaddedSize = 0U;
+    uint32_t surfaceStateHeapSize = 0U;
+    uint32_t reserved = 0U;
+};
+
+// Structures below are stored as raw bytes - any change of their layout has to come with bumped version,
+// so that images cached by older drivers get rejected.
+static_assert(version == 2U, "update expected sizes of serialized structures together with ProgramInfoCache::version");
+static_assert(sizeof(ImageHeader) == 32U, "bump ProgramInfoCache::version");
+static_assert(sizeof(GlobalSurfaceRecord) == 16U, "bump ProgramInfoCache::version");
+static_assert(sizeof(HeapsRecord) == 32U, "bump ProgramInfoCache::version");
+static_assert(sizeof(KernelDescriptor::KernelAttributes) == 56U, "bump ProgramInfoCache::version");
+static_assert(sizeof(EntryPoints) == 6U, "bump ProgramInfoCache::version");
+static_assert(sizeof(DispatchTraits) == 38U, "bump ProgramInfoCache::version");
+static_assert(sizeof(BindingTable) == 4U, "bump ProgramInfoCache::version");
+static_assert(sizeof(SamplerTable) == 6U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ImplicitArgs) == 126U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ArgTypeTraits) == 4U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ArgDescPointer) == 14U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ArgDescImage) == 28U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ArgDescSampler) == 16U, "bump ProgramInfoCache::version");
+static_assert(sizeof(ArgDescValue::Element) == 6U, "bump ProgramInfoCache::version");
+
+// every debug flag changing the outcome of zebin decoding
+uint32_t getDecoderConfig() {
+    uint32_t decoderConfig = 0U;
+    decoderConfig |= DebugManager.flags.ZebinAppendElws.get() ? (1U << 0) : 0U;
+    decoderConfig |= DebugManager.flags.ZebinIgnoreIcbeVersion.get() ? (1U << 1) : 0U;
+    return decoderConfig;
+}
+
+uint64_t getDeviceBinaryHash(ArrayRef<const uint8_t> deviceBinary) {
+    return Hash::hash(reinterpret_cast<const char *>(deviceBinary.begin()), deviceBinary.size());
+}
+
+bool isWithin(const void *ptr, size_t size, const void *rangeBegin, size_t rangeSize) {
+    auto ptrAddress = reinterpret_cast<uintptr_t>(ptr);
+    auto rangeAddress = reinterpret_cast<uintptr_t>(rangeBegin);
+    return (ptrAddress >= rangeAddress) && (ptrAddress - rangeAddress <= rangeSize) && (size <= rangeSize - (ptrAddress - rangeAddress));
+}
+
+class ImageWriter {
+  public:
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        append(&value, sizeof(T));
+    }
+
+    void writeBytes(const void *data, size_t size) {
+        write<uint64_t>(size);
+        append(data, size);
+    }
+
+    void writeString(const std::string &str) {
+        writeBytes(str.data(), str.size());
+    }
+
+    std::vector<uint8_t> data;
+
+  protected:
+    void append(const void *src, size_t size) {
+        auto bytes = reinterpret_cast<const uint8_t *>(src);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+};
+
+class ImageReader {
+  public:
+    ImageReader(ArrayRef<const uint8_t> image) : image(image) {}
+
+    template <typename T>
+    bool read(T &out) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        if (sizeof(T) > image.size() - position) {
+            return false;
+        }
+        memcpy(&out, image.begin() + position, sizeof(T));
+        position += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(ArrayRef<const uint8_t> &out) {
+        uint64_t size = 0U;
+        if ((false == read(size)) || (size > image.size() - position)) {
+            return false;
+        }
+        out = ArrayRef<const uint8_t>(image.begin() + position, static_cast<size_t>(size));
+        position += static_cast<size_t>(size);
+        return true;
+    }
+
+    bool readString(std::string &out) {
+        ArrayRef<const uint8_t> bytes;
+        if (false == readBytes(bytes)) {
+            return false;
+        }
+        out.assign(reinterpret_cast<const char *>(bytes.begin()), bytes.size());
+        return true;
+    }
+
+    bool isFullyConsumed() const {
+        return image.size() == position;
+    }
+
+  protected:
+    ArrayRef<const uint8_t> image;
+    size_t position = 0U;
+};
+
+bool isRestorableFromImage(const KernelInfo &kernelInfo, ArrayRef<const uint8_t> deviceBinary) {
+    const auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    const auto &heapInfo = kernelInfo.heapInfo;
+    if ((false == kernelDescriptor.payloadMappings.explicitArgsExtendedDescriptors.empty()) ||
+        (false == kernelDescriptor.kernelMetadata.printfStringsMap.empty()) ||
+        (false == kernelDescriptor.kernelMetadata.deviceSideEnqueueChildrenKernelsIdOffset.empty()) ||
+        (false == kernelDescriptor.kernelMetadata.allByValueKernelArguments.empty()) ||
+        (nullptr != kernelDescriptor.external.debugData) || (nullptr != kernelDescriptor.external.igcInfoForGtpin)) {
+        return false;
+    }
+    if ((nullptr != heapInfo.pGsh) || (nullptr != heapInfo.pDsh) || (0U != heapInfo.GeneralStateHeapSize) || (0U != heapInfo.DynamicStateHeapSize)) {
+        return false;
+    }
+    if ((nullptr != heapInfo.pKernelHeap) && (false == isWithin(heapInfo.pKernelHeap, heapInfo.KernelHeapSize, deviceBinary.begin(), deviceBinary.size()))) {
+        return false;
+    }
+    if ((nullptr != heapInfo.pSsh) && (false == isWithin(heapInfo.pSsh, heapInfo.SurfaceStateHeapSize, kernelDescriptor.generatedHeaps.data(), kernelDescriptor.generatedHeaps.size()))) {
+        return false;
+    }
+    return true;
+}
+
+bool serializeGlobalSurface(ImageWriter &writer, const ProgramInfo::GlobalSurfaceInfo &surface, ArrayRef<const uint8_t> deviceBinary) {
+    GlobalSurfaceRecord record;
+    record.size = surface.size;
+    if (nullptr != surface.initData) {
+        if (false == isWithin(surface.initData, surface.size, deviceBinary.begin(), deviceBinary.size())) {
+            return false;
+        }
+        record.offsetInDeviceBinary = ptrDiff(surface.initData, deviceBinary.begin());
+    }
+    writer.write(record);
+    return true;
+}
+
+bool deserializeGlobalSurface(ImageReader &reader, ProgramInfo::GlobalSurfaceInfo &surface, ArrayRef<const uint8_t> deviceBinary) {
+    GlobalSurfaceRecord record;
+    if (false == reader.read(record)) {
+        return false;
+    }
+    if (invalidOffset == record.offsetInDeviceBinary) {
+        surface.initData = nullptr;
+    } else if ((record.offsetInDeviceBinary > deviceBinary.size()) || (record.size > deviceBinary.size() - record.offsetInDeviceBinary)) {
+        return false;
+    } else {
+        surface.initData = deviceBinary.begin() + record.offsetInDeviceBinary;
+    }
+    surface.size = static_cast<size_t>(record.size);
+    return true;
+}
+
+void serializeArg(ImageWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo().packed);
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        const auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+        break;
+    }
+    }
+}
+
+bool deserializeArg(ImageReader &reader, ArgDescriptor &arg) {
+    ArgDescriptor::ArgType type = ArgDescriptor::ArgTUnknown;
+    if ((false == reader.read(type)) || (type > ArgDescriptor::ArgTValue)) {
+        return false;
+    }
+    arg = ArgDescriptor(type);
+    if ((false == reader.read(arg.getTraits())) || (false == reader.read(arg.getExtendedTypeInfo().packed))) {
+        return false;
+    }
+    switch (type) {
+    default:
+        return true;
+    case ArgDescriptor::ArgTPointer:
+        return reader.read(arg.as<ArgDescPointer>());
+    case ArgDescriptor::ArgTImage:
+        return reader.read(arg.as<ArgDescImage>());
+    case ArgDescriptor::ArgTSampler:
+        return reader.read(arg.as<ArgDescSampler>());
+    case ArgDescriptor::ArgTValue: {
+        uint32_t elementsCount = 0U;
+        if (false == reader.read(elementsCount)) {
+            return false;
+        }
+        auto &elements = arg.as<ArgDescValue>().elements;
+        for (uint32_t i = 0; i < elementsCount; ++i) {
+            ArgDescValue::Element element;
+            if (false == reader.read(element)) {
+                return false;
+            }
+            elements.push_back(element);
+        }
+        return true;
+    }
+    }
+}
+
+void serializeKernel(ImageWriter &writer, const KernelInfo &kernelInfo, ArrayRef<const uint8_t> deviceBinary) {
+    const auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    const auto &payloadMappings = kernelDescriptor.payloadMappings;
+    const auto &kernelMetadata = kernelDescriptor.kernelMetadata;
+
+    writer.write(kernelDescriptor.kernelAttributes);
+    writer.write(kernelDescriptor.entryPoints);
+    writer.write(payloadMappings.dispatchTraits);
+    writer.write(payloadMappings.bindingTable);
+    writer.write(payloadMappings.samplerTable);
+    writer.write(payloadMappings.implicitArgs);
+    writer.write(kernelMetadata.deviceSideEnqueueBlockInterfaceDescriptorOffset);
+    writer.write(kernelMetadata.compiledSubGroupsNumber);
+    writer.write(kernelMetadata.requiredSubGroupSize);
+    writer.writeString(kernelMetadata.kernelName);
+    writer.writeString(kernelMetadata.kernelLanguageAttributes);
+
+    writer.write(static_cast<uint32_t>(payloadMappings.explicitArgs.size()));
+    for (const auto &arg : payloadMappings.explicitArgs) {
+        serializeArg(writer, arg);
+    }
+
+    writer.write(static_cast<uint32_t>(kernelDescriptor.explicitArgsExtendedMetadata.size()));
+    for (const auto &argMetadata : kernelDescriptor.explicitArgsExtendedMetadata) {
+        writer.writeString(argMetadata.argName);
+        writer.writeString(argMetadata.type);
+        writer.writeString(argMetadata.accessQualifier);
+        writer.writeString(argMetadata.addressQualifier);
+        writer.writeString(argMetadata.typeQualifiers);
+    }
+
+    writer.writeBytes(kernelDescriptor.generatedHeaps.data(), kernelDescriptor.generatedHeaps.size());
+
+    HeapsRecord heaps;
+    if (nullptr != kernelInfo.heapInfo.pKernelHeap) {
+        heaps.kernelHeapOffsetInDeviceBinary = ptrDiff(kernelInfo.heapInfo.pKernelHeap, deviceBinary.begin());
+    }
+    if (nullptr != kernelInfo.heapInfo.pSsh) {
+        heaps.sshOffsetInGeneratedHeaps = ptrDiff(kernelInfo.heapInfo.pSsh, kernelDescriptor.generatedHeaps.data());
+    }
+    heaps.kernelHeapSize = kernelInfo.heapInfo.KernelHeapSize;
+    heaps.kernelUnpaddedSize = kernelInfo.heapInfo.KernelUnpaddedSize;
+    heaps.surfaceStateHeapSize = kernelInfo.heapInfo.SurfaceStateHeapSize;
+    writer.write(heaps);
+}
+
+bool deserializeKernel(ImageReader &reader, KernelInfo &kernelInfo, ArrayRef<const uint8_t> deviceBinary) {
+    auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    auto &payloadMappings = kernelDescriptor.payloadMappings;
+    auto &kernelMetadata = kernelDescriptor.kernelMetadata;
+
+    bool success = reader.read(kernelDescriptor.kernelAttributes);
+    success = success && reader.read(kernelDescriptor.entryPoints);
+    success = success && reader.read(payloadMappings.dispatchTraits);
+    success = success && reader.read(payloadMappings.bindingTable);
+    success = success && reader.read(payloadMappings.samplerTable);
+    success = success && reader.read(payloadMappings.implicitArgs);
+    success = success && reader.read(kernelMetadata.deviceSideEnqueueBlockInterfaceDescriptorOffset);
+    success = success && reader.read(kernelMetadata.compiledSubGroupsNumber);
+    success = success && reader.read(kernelMetadata.requiredSubGroupSize);
+    success = success && reader.readString(kernelMetadata.kernelName);
+    success = success && reader.readString(kernelMetadata.kernelLanguageAttributes);
+
+    uint32_t argsCount = 0U;
+    success = success && reader.read(argsCount);
+    for (uint32_t i = 0; success && (i < argsCount); ++i) {
+        ArgDescriptor arg;
+        success = deserializeArg(reader, arg);
+        payloadMappings.explicitArgs.push_back(arg);
+    }
+
+    uint32_t argsMetadataCount = 0U;
+    success = success && reader.read(argsMetadataCount);
+    for (uint32_t i = 0; success && (i < argsMetadataCount); ++i) {
+        ArgTypeMetadataExtended argMetadata;
+        success = reader.readString(argMetadata.argName);
+        success = success && reader.readString(argMetadata.type);
+        success = success && reader.readString(argMetadata.accessQualifier);
+        success = success && reader.readString(argMetadata.addressQualifier);
+        success = success && reader.readString(argMetadata.typeQualifiers);
+        kernelDescriptor.explicitArgsExtendedMetadata.push_back(std::move(argMetadata));
+    }
+
+    ArrayRef<const uint8_t> generatedHeaps;
+    success = success && reader.readBytes(generatedHeaps);
+    kernelDescriptor.generatedHeaps.assign(generatedHeaps.begin(), generatedHeaps.end());
+
+    HeapsRecord heaps;
+    success = success && reader.read(heaps);
+    if (false == success) {
+        return false;
+    }
+
+    kernelInfo.heapInfo.KernelHeapSize = heaps.kernelHeapSize;
+    kernelInfo.heapInfo.KernelUnpaddedSize = heaps.kernelUnpaddedSize;
+    kernelInfo.heapInfo.SurfaceStateHeapSize = heaps.surfaceStateHeapSize;
+    if (invalidOffset != heaps.kernelHeapOffsetInDeviceBinary) {
+        if ((heaps.kernelHeapOffsetInDeviceBinary > deviceBinary.size()) || (heaps.kernelHeapSize > deviceBinary.size() - heaps.kernelHeapOffsetInDeviceBinary)) {
+            return false;
+        }
+        kernelInfo.heapInfo.pKernelHeap = deviceBinary.begin() + heaps.kernelHeapOffsetInDeviceBinary;
+    }
+    if (invalidOffset != heaps.sshOffsetInGeneratedHeaps) {
+        auto generatedHeapsSize = kernelDescriptor.generatedHeaps.size();
+        if ((heaps.sshOffsetInGeneratedHeaps > generatedHeapsSize) || (heaps.surfaceStateHeapSize > generatedHeapsSize - heaps.sshOffsetInGeneratedHeaps)) {
+            return false;
+        }
+        kernelInfo.heapInfo.pSsh = kernelDescriptor.generatedHeaps.data() + heaps.sshOffsetInGeneratedHeaps;
+    }
+    return true;
+}
+} // namespace
+
+std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const uint8_t> deviceBinary) {
+    const std::string cacheTag = "program_info_v" + std::to_string(version);
+    return CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(reinterpret_cast<const char *>(deviceBinary.begin()), deviceBinary.size()),
+                                            ArrayRef<const char>(), ArrayRef<const char>(cacheTag.c_str(), cacheTag.size()));
+}
+
+std::vector<uint8_t> serialize(const ProgramInfo &src, ArrayRef<const uint8_t> deviceBinary) {
+    if (nullptr != src.linkerInput) {
+        return {};
+    }
+    for (const auto &kernelInfo : src.kernelInfos) {
+        if (false == isRestorableFromImage(*kernelInfo, deviceBinary)) {
+            return {};
+        }
+    }
+
+    ImageWriter writer;
+    ImageHeader header;
+    header.magic = magic;
+    header.version = version;
+    header.deviceBinaryHash = getDeviceBinaryHash(deviceBinary);
+    header.deviceBinarySize = deviceBinary.size();
+    header.decoderConfig = getDecoderConfig();
+    header.kernelsCount = static_cast<uint32_t>(src.kernelInfos.size());
+    writer.write(header);
+
+    if ((false == serializeGlobalSurface(writer, src.globalConstants, deviceBinary)) ||
+        (false == serializeGlobalSurface(writer, src.globalVariables, deviceBinary))) {
+        return {};
+    }
+
+    for (const auto &kernelInfo : src.kernelInfos) {
+        serializeKernel(writer, *kernelInfo, deviceBinary);
+    }
+    return std::move(writer.data);
+}
+
+bool deserialize(ProgramInfo &dst, ArrayRef<const uint8_t> image, ArrayRef<const uint8_t> deviceBinary) {
+    ImageReader reader(image);
+    ImageHeader header;
+    if ((false == reader.read(header)) || (magic != header.magic) || (version != header.version) ||
+        (getDecoderConfig() != header.decoderConfig) ||
+        (deviceBinary.size() != header.deviceBinarySize) || (getDeviceBinaryHash(deviceBinary) != header.deviceBinaryHash)) {
+        return false;
+    }
+
+    ProgramInfo restored;
+    if ((false == deserializeGlobalSurface(reader, restored.globalConstants, deviceBinary)) ||
+        (false == deserializeGlobalSurface(reader, restored.globalVariables, deviceBinary))) {
+        return false;
+    }
+
+    restored.kernelInfos.reserve(header.kernelsCount);
+    for (uint32_t i = 0; i < header.kernelsCount; ++i) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        if (false == deserializeKernel(reader, *kernelInfo, deviceBinary)) {
+            return false;
+        }
+        restored.kernelInfos.push_back(kernelInfo.release());
+    }
+    if (false == reader.isFullyConsumed()) {
+        return false;
+    }
+
+    dst.globalConstants = restored.globalConstants;
+    dst.globalVariables = restored.globalVariables;
+    dst.kernelInfos.insert(dst.kernelInfos.end(), restored.kernelInfos.begin(), restored.kernelInfos.end());
+    restored.kernelInfos.clear();
+    return true;
+}
+} // namespace ProgramInfoCache
+
+std::pair<DecodeError, DeviceBinaryFormat> decodeSingleDeviceBinaryWithCache(ProgramInfo &dst, const SingleDeviceBinary &src, const Device &device,
+                                                                             std::string &outErrReason, std::string &outWarning) {
+    CompilerCache *cache = nullptr;
+    if ((1 == DebugManager.flags.EnableProgramInfoCache.get()) && isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(src.deviceBinary)) {
+        auto compilerInterface = device.getCompilerInterface();
+        cache = (nullptr != compilerInterface) ? compilerInterface->getCache() : nullptr;
+    }
+    if (nullptr == cache) {
+        return decodeSingleDeviceBinary(dst, src, outErrReason, outWarning);
+    }
+
+    auto cacheFileName = ProgramInfoCache::getCachedFileName(device.getHardwareInfo(), src.deviceBinary);
+    size_t cachedImageSize = 0U;
+    auto cachedImage = cache->loadCachedBinary(cacheFileName, cachedImageSize);
+    if (nullptr != cachedImage) {
+        ArrayRef<const uint8_t> image(reinterpret_cast<const uint8_t *>(cachedImage.get()), cachedImageSize);
+        if (ProgramInfoCache::deserialize(dst, image, src.deviceBinary)) {
+            return std::make_pair(DecodeError::Success, DeviceBinaryFormat::Zebin);
+        }
+    }
+
+    auto ret = decodeSingleDeviceBinary(dst, src, outErrReason, outWarning);
+    if (DecodeError::Success == ret.first) {
+        auto image = ProgramInfoCache::serialize(dst, src.deviceBinary);
+        if (false == image.empty()) {
+            cache->cacheBinary(cacheFileName, reinterpret_cast<const char *>(image.data()), static_cast<uint32_t>(image.size()));
+        }
+    }
+    return ret;
+}
+
+} // namespace NEO
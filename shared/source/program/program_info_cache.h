@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class Device;
+struct HardwareInfo;
+struct ProgramInfo;
+
+// Flat image of ProgramInfo decoded from zebin, stored in compiler cache next to cached binaries.
+// Kernel heaps and global data are kept as offsets into the device binary the image was created from,
+// so restoring it skips .ze_info parsing completely.
+namespace ProgramInfoCache {
+constexpr uint32_t magic = 0x4943504e; // NPCI
+constexpr uint32_t version = 2U;
+
+std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const uint8_t> deviceBinary);
+
+// returns empty image when src holds state that can't be restored from the device binary
+std::vector<uint8_t> serialize(const ProgramInfo &src, ArrayRef<const uint8_t> deviceBinary);
+
+// fails and leaves dst untouched on version, layout or device binary mismatch
+bool deserialize(ProgramInfo &dst, ArrayRef<const uint8_t> image, ArrayRef<const uint8_t> deviceBinary);
+} // namespace ProgramInfoCache
+
+// decodes src, going through device's compiler cache for zebin when EnableProgramInfoCache is set
+std::pair<DecodeError, DeviceBinaryFormat> decodeSingleDeviceBinaryWithCache(ProgramInfo &dst, const SingleDeviceBinary &src, const Device &device,
+                                                                             std::string &outErrReason, std::string &outWarning);
+
+} // namespace NEO
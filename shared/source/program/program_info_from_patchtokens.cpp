@@ -11,10 +11,14 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/kernel_info_from_patchtokens.h"
 
+#include <memory>
+#include <vector>
+
 namespace NEO {
 
 bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens &src) {
@@ -26,11 +30,13 @@ bool requiresLocalMemoryWindowVA(const PatchTokenBinary::ProgramFromPatchtokens
     return false;
 }
 
-void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum) {
-    auto kernelInfo = std::make_unique<KernelInfo>();
+void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &decodedProgram, uint32_t kernelNum, std::unique_ptr<KernelInfo> kernelInfo) {
     const PatchTokenBinary::KernelFromPatchtokens &decodedKernel = decodedProgram.kernels[kernelNum];
 
-    NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
+    if (kernelInfo == nullptr) {
+        kernelInfo = std::make_unique<KernelInfo>();
+        NEO::populateKernelInfo(*kernelInfo, decodedKernel, decodedProgram.header->GPUPointerSizeInBytes);
+    }
 
     if (decodedKernel.tokens.programSymbolTable) {
         dst.prepareLinkerInputStorage();
@@ -46,8 +52,21 @@ void populateSingleKernelInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramF
 }
 
 void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
-    for (uint32_t i = 0; i < src.kernels.size(); ++i) {
-        populateSingleKernelInfo(dst, src, i);
+    auto populateThreadsCount = PatchTokenBinary::getKernelsDecodeThreadsCount(src.kernels.size());
+    if (populateThreadsCount <= 1U) {
+        for (uint32_t i = 0; i < src.kernels.size(); ++i) {
+            populateSingleKernelInfo(dst, src, i, nullptr);
+        }
+    } else {
+        // kernel infos are independent of each other, linker input is shared so it is filled in kernel order afterwards
+        std::vector<std::unique_ptr<KernelInfo>> kernelInfos(src.kernels.size());
+        parallelFor(kernelInfos.size(), populateThreadsCount, [&](size_t kernelId) {
+            kernelInfos[kernelId] = std::make_unique<KernelInfo>();
+            NEO::populateKernelInfo(*kernelInfos[kernelId], src.kernels[kernelId], src.header->GPUPointerSizeInBytes);
+        });
+        for (uint32_t i = 0; i < src.kernels.size(); ++i) {
+            populateSingleKernelInfo(dst, src, i, std::move(kernelInfos[i]));
+        }
     }
 
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
@@ -20,6 +20,21 @@ namespace NEO {
 
 GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAllocManager, NEO::Device &device, size_t size, bool constant,
                                            LinkerInput *const linkerInput, const void *initData) {
+    MemoryTransfers pendingTransfers;
+    auto gpuAllocation = allocateGlobalsSurface(svmAllocManager, device, size, constant, linkerInput, initData, pendingTransfers);
+    if (!gpuAllocation) {
+        return nullptr;
+    }
+
+    auto success = MemoryTransferHelper::transferMemoryToAllocations(device, pendingTransfers);
+
+    UNRECOVERABLE_IF(!success);
+
+    return gpuAllocation;
+}
+
+GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAllocManager, NEO::Device &device, size_t size, bool constant,
+                                           LinkerInput *const linkerInput, const void *initData, MemoryTransfers &pendingTransfers) {
     bool globalsAreExported = false;
     GraphicsAllocation *gpuAllocation = nullptr;
 
@@ -56,10 +71,12 @@ GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAlloc
     auto &hwInfo = device.getHardwareInfo();
     auto &helper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
-    auto success = MemoryTransferHelper::transferMemoryToAllocation(helper.isBlitCopyRequiredForLocalMemory(hwInfo, *gpuAllocation),
-                                                                    device, gpuAllocation, 0, initData, size);
-
-    UNRECOVERABLE_IF(!success);
+    MemoryTransfer transfer;
+    transfer.dstAllocation = gpuAllocation;
+    transfer.srcMemory = initData;
+    transfer.srcSize = size;
+    transfer.useBlitter = helper.isBlitCopyRequiredForLocalMemory(hwInfo, *gpuAllocation);
+    pendingTransfers.push_back(transfer);
 
     return gpuAllocation;
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 namespace NEO {
 
@@ -15,9 +16,16 @@ class Device;
 class GraphicsAllocation;
 class SVMAllocsManager;
 struct LinkerInput;
+struct MemoryTransfer;
 
 GraphicsAllocation *allocateGlobalsSurface(SVMAllocsManager *const svmAllocManager, Device &device,
                                            size_t size, bool constant,
                                            LinkerInput *const linkerInput, const void *initData);
 
+// upload of initData is appended to pendingTransfers, so that it can be batched with other module uploads
+GraphicsAllocation *allocateGlobalsSurface(SVMAllocsManager *const svmAllocManager, Device &device,
+                                           size_t size, bool constant,
+                                           LinkerInput *const linkerInput, const void *initData,
+                                           std::vector<MemoryTransfer> &pendingTransfers);
+
 } // namespace NEO
@@ -6,10 +6,17 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <string>
 
 namespace NEO {
 
+struct TbxMemoryRange {
+    uint64_t addr;
+    void *memory;
+    size_t size;
+};
+
 class TbxSockets {
   protected:
     TbxSockets() = default;
@@ -24,6 +31,15 @@ class TbxSockets {
     virtual bool readMemory(uint64_t addr, void *memory, size_t size) = 0;
     virtual bool writeMemory(uint64_t addr, const void *memory, size_t size, uint32_t type) = 0;
 
+    // Implementations may issue all requests before awaiting the first response
+    virtual bool readMemoryRanges(const TbxMemoryRange *ranges, size_t count) {
+        bool success = true;
+        for (size_t i = 0; i < count; i++) {
+            success &= readMemory(ranges[i].addr, ranges[i].memory, ranges[i].size);
+        }
+        return success;
+    }
+
     virtual bool readMMIO(uint32_t offset, uint32_t *value) = 0;
     virtual bool writeMMIO(uint32_t offset, uint32_t value) = 0;
 
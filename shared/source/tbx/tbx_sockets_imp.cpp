@@ -7,6 +7,7 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -28,16 +29,42 @@ typedef struct sockaddr SOCKADDR;
 #endif
 #include "tbx_proto.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace NEO {
 
+namespace {
+void fillReadMemoryRequest(HAS_MSG &cmd, uint32_t transId, uint64_t addrOffset, size_t size) {
+    UNRECOVERABLE_IF(size > std::numeric_limits<uint32_t>::max());
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.hdr.msg_type = HAS_READ_DATA_REQ_TYPE;
+    cmd.hdr.trans_id = transId;
+    cmd.hdr.size = sizeof(HAS_READ_DATA_REQ);
+    cmd.u.read_req.address = static_cast<uint32_t>(addrOffset);
+    cmd.u.read_req.address_h = static_cast<uint32_t>(addrOffset >> 32);
+    cmd.u.read_req.addr_type = 0;
+    cmd.u.read_req.size = static_cast<uint32_t>(size);
+    cmd.u.read_req.ownership_req = 0;
+    cmd.u.read_req.frontdoor = 0;
+    cmd.u.read_req.cacheline_disable = cmd.u.read_req.frontdoor;
+}
+} // namespace
+
+constexpr size_t TbxSocketsImp::maxOutstandingReadRequests;
+
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (DebugManager.flags.TbxSendBufferSize.get() > 0) {
+        sendBufferCapacity = static_cast<size_t>(DebugManager.flags.TbxSendBufferSize.get());
+        sendBuffer.reserve(sendBufferCapacity);
+    }
 }
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushSendBuffer();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -188,17 +215,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
     HAS_MSG cmd;
-    memset(&cmd, 0, sizeof(cmd));
-    cmd.hdr.msg_type = HAS_READ_DATA_REQ_TYPE;
-    cmd.hdr.trans_id = transID++;
-    cmd.hdr.size = sizeof(HAS_READ_DATA_REQ);
-    cmd.u.read_req.address = static_cast<uint32_t>(addrOffset);
-    cmd.u.read_req.address_h = static_cast<uint32_t>(addrOffset >> 32);
-    cmd.u.read_req.addr_type = 0;
-    cmd.u.read_req.size = static_cast<uint32_t>(size);
-    cmd.u.read_req.ownership_req = 0;
-    cmd.u.read_req.frontdoor = 0;
-    cmd.u.read_req.cacheline_disable = cmd.u.read_req.frontdoor;
+    fillReadMemoryRequest(cmd, transID++, addrOffset, size);
 
     bool success;
     do {
@@ -226,7 +243,48 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
     return success;
 }
 
+bool TbxSocketsImp::readMemoryRanges(const TbxMemoryRange *ranges, size_t count) {
+    // Requests go out in windows and the server answers them in order. Responses of a window are
+    // drained before the next one is sent, so the server never blocks writing responses nobody reads
+    // while we block writing requests it doesn't read.
+    constexpr size_t requestSize = sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ);
+    char requests[requestSize * maxOutstandingReadRequests];
+
+    bool success = true;
+    for (size_t windowStart = 0; success && windowStart < count; windowStart += maxOutstandingReadRequests) {
+        auto windowSize = std::min(count - windowStart, maxOutstandingReadRequests);
+        auto firstTransId = transID;
+        for (size_t i = 0; i < windowSize; i++) {
+            HAS_MSG cmd;
+            fillReadMemoryRequest(cmd, transID++, ranges[windowStart + i].addr, ranges[windowStart + i].size);
+            memcpy_s(&requests[i * requestSize], requestSize, &cmd, requestSize);
+        }
+
+        success = sendWriteData(requests, windowSize * requestSize);
+
+        for (size_t i = 0; success && i < windowSize; i++) {
+            HAS_MSG resp;
+            success = getResponseData(&resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES));
+            if (!success) {
+                break;
+            }
+
+            if (resp.hdr.msg_type != HAS_READ_DATA_RES_TYPE || resp.hdr.trans_id != firstTransId + static_cast<uint32_t>(i)) {
+                cerrStream << "Out of sequence read data packet?" << std::endl;
+                success = false;
+                break;
+            }
+
+            success = getResponseData(ranges[windowStart + i].memory, ranges[windowStart + i].size);
+        }
+    }
+
+    DEBUG_BREAK_IF(!success);
+    return success;
+}
+
 bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    UNRECOVERABLE_IF(size > std::numeric_limits<uint32_t>::max());
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_WRITE_DATA_REQ_TYPE;
@@ -275,6 +333,34 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
+    if (sendBufferCapacity == 0) {
+        return sendToSocket(buffer, sizeInBytes);
+    }
+
+    if (sendBuffer.size() + sizeInBytes > sendBufferCapacity) {
+        if (!flushSendBuffer()) {
+            return false;
+        }
+        if (sizeInBytes >= sendBufferCapacity) {
+            return sendToSocket(buffer, sizeInBytes);
+        }
+    }
+
+    auto dataBuffer = reinterpret_cast<const char *>(buffer);
+    sendBuffer.insert(sendBuffer.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::flushSendBuffer() {
+    if (sendBuffer.empty()) {
+        return true;
+    }
+    auto success = sendToSocket(sendBuffer.data(), sendBuffer.size());
+    sendBuffer.clear();
+    return success;
+}
+
+bool TbxSocketsImp::sendToSocket(const void *buffer, size_t sizeInBytes) {
     size_t totalSent = 0;
     auto dataBuffer = reinterpret_cast<const char *>(buffer);
 
@@ -296,6 +382,10 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
 }
 
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
+    if (!flushSendBuffer()) {
+        return false;
+    }
+
     size_t totalRecv = 0;
     auto dataBuffer = static_cast<char *>(buffer);
 
@@ -11,6 +11,7 @@
 #include "os_socket.h"
 
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -26,6 +27,8 @@ class TbxSocketsImp : public TbxSockets {
 
     bool readMemory(uint64_t offset, void *data, size_t size) override;
     bool writeMemory(uint64_t offset, const void *data, size_t size, uint32_t type) override;
+    bool readMemoryRanges(const TbxMemoryRange *ranges, size_t count) override;
+    static constexpr size_t maxOutstandingReadRequests = 16;
 
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
@@ -35,13 +38,19 @@ class TbxSocketsImp : public TbxSockets {
     SOCKET m_socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
-    bool getResponseData(void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    bool sendToSocket(const void *buffer, size_t sizeInBytes);
+    bool flushSendBuffer();
+    MOCKABLE_VIRTUAL bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // Requests are held here until a response is awaited, see TbxSendBufferSize
+    size_t sendBufferCapacity = 0;
+    std::vector<char> sendBuffer;
 };
 } // namespace NEO
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/async_file_writer.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+AsyncFileWriter::AsyncFileWriter(std::ostream &output, size_t chunkSize, size_t maxQueuedChunks)
+    : output(output), chunkSize(chunkSize), maxQueuedChunks(maxQueuedChunks) {
+    stagingChunk.reserve(chunkSize);
+    writerThread = Thread::create(writerThreadEntry, reinterpret_cast<void *>(this));
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    if (!stagingChunk.empty()) {
+        submitStagingChunk();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWriter = true;
+    }
+    queueNotEmpty.notify_one();
+    writerThread->join();
+    output.flush();
+}
+
+void AsyncFileWriter::write(const char *data, size_t size) {
+    while (size > 0) {
+        auto sizeThisIteration = std::min(size, chunkSize - stagingChunk.size());
+        stagingChunk.insert(stagingChunk.end(), data, data + sizeThisIteration);
+        data += sizeThisIteration;
+        size -= sizeThisIteration;
+
+        if (stagingChunk.size() == chunkSize) {
+            submitStagingChunk();
+        }
+    }
+}
+
+void AsyncFileWriter::flush() {
+    if (!stagingChunk.empty()) {
+        submitStagingChunk();
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    queueNotFull.wait(lock, [this] { return queuedChunks.empty() && !writerBusy; });
+    output.flush();
+}
+
+void AsyncFileWriter::submitStagingChunk() {
+    std::unique_lock<std::mutex> lock(mutex);
+    queueNotFull.wait(lock, [this] { return queuedChunks.size() < maxQueuedChunks; });
+    queuedChunks.push_back(std::move(stagingChunk));
+
+    if (freeChunks.empty()) {
+        stagingChunk = std::vector<char>();
+        stagingChunk.reserve(chunkSize);
+    } else {
+        stagingChunk = std::move(freeChunks.back());
+        freeChunks.pop_back();
+    }
+    lock.unlock();
+    queueNotEmpty.notify_one();
+}
+
+void *AsyncFileWriter::writerThreadEntry(void *arg) {
+    reinterpret_cast<AsyncFileWriter *>(arg)->writerLoop();
+    return nullptr;
+}
+
+void AsyncFileWriter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        queueNotEmpty.wait(lock, [this] { return stopWriter || !queuedChunks.empty(); });
+        if (queuedChunks.empty()) {
+            return;
+        }
+
+        auto chunk = std::move(queuedChunks.front());
+        queuedChunks.pop_front();
+        writerBusy = true;
+        lock.unlock();
+
+        output.write(chunk.data(), chunk.size());
+
+        lock.lock();
+        writerBusy = false;
+        chunk.clear();
+        freeChunks.push_back(std::move(chunk));
+        queueNotFull.notify_all();
+    }
+}
+} // namespace NEO
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Moves stream writes off the calling thread.
+// Data is staged into fixed size chunks which a background thread writes in submission order.
+// The queue is bounded, so a producer outrunning the disk blocks instead of growing memory.
+class AsyncFileWriter : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultChunkSize = 4 * 1024 * 1024;
+    static constexpr size_t defaultMaxQueuedChunks = 16;
+
+    AsyncFileWriter(std::ostream &output, size_t chunkSize, size_t maxQueuedChunks);
+    ~AsyncFileWriter();
+
+    void write(const char *data, size_t size);
+    void flush();
+
+  protected:
+    void submitStagingChunk();
+    static void *writerThreadEntry(void *arg);
+    void writerLoop();
+
+    std::ostream &output;
+    const size_t chunkSize;
+    const size_t maxQueuedChunks;
+    std::vector<char> stagingChunk;
+
+    std::mutex mutex;
+    std::condition_variable queueNotEmpty;
+    std::condition_variable queueNotFull;
+    std::deque<std::vector<char>> queuedChunks;
+    std::vector<std::vector<char>> freeChunks;
+    bool writerBusy = false;
+    bool stopWriter = false;
+    std::unique_ptr<Thread> writerThread;
+};
+} // namespace NEO
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+// Limits number of threads processing itemsCount independent items.
+// debugMaxThreads == -1 uses one thread per minItemsPerThread items (up to hardware concurrency),
+// otherwise up to debugMaxThreads threads are used regardless of itemsCount.
+inline size_t getParallelThreadsCount(size_t itemsCount, size_t minItemsPerThread, int32_t debugMaxThreads) {
+    size_t maxThreads = std::max(1U, std::thread::hardware_concurrency());
+    size_t threadsCount = itemsCount / minItemsPerThread;
+    if (debugMaxThreads != -1) {
+        maxThreads = static_cast<size_t>(std::max(1, debugMaxThreads));
+        threadsCount = itemsCount;
+    }
+    return std::min(maxThreads, threadsCount);
+}
+
+// Calls function(itemId) for each itemId in [0, itemsCount) using threadsCount threads, including the calling one.
+// Items are picked dynamically, so function should store results per itemId to keep output order deterministic.
+// When threads can't be created, items are processed by threads started so far - at least by the calling one.
+template <typename ThreadT = std::thread, typename FunctionT>
+void parallelFor(size_t itemsCount, size_t threadsCount, FunctionT &&function) {
+    if (threadsCount <= 1U) {
+        for (size_t itemId = 0U; itemId < itemsCount; ++itemId) {
+            function(itemId);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextItem{0U};
+    auto processItems = [&]() {
+        for (auto itemId = nextItem++; itemId < itemsCount; itemId = nextItem++) {
+            function(itemId);
+        }
+    };
+    std::vector<ThreadT> threads;
+    for (size_t i = 1U; i < threadsCount; ++i) {
+        try {
+            threads.emplace_back(processItems);
+        } catch (...) {
+            break;
+        }
+    }
+    processItems();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace NEO
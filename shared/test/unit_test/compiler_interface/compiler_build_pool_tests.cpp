@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_build_pool.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/mocks/mock_compiler_interface.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "test.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+class BlockingCompilerInterface : public MockCompilerInterface {
+  public:
+    TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &output) override {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            builtSources.push_back(std::string(input.src.begin(), input.src.size()));
+            buildingThreads.push_back(std::this_thread::get_id());
+            released.wait(lock, [this]() { return (false == blocked) || (std::this_thread::get_id() == neverBlockedThread); });
+        }
+        output.deviceBinary.mem = makeCopy(input.src.begin(), input.src.size());
+        output.deviceBinary.size = input.src.size();
+        output.backendCompilerLog = "built";
+        return buildResult;
+    }
+
+    void unblock() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            blocked = false;
+        }
+        released.notify_all();
+    }
+
+    std::vector<std::string> getBuiltSources() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return builtSources;
+    }
+
+    std::vector<std::thread::id> getBuildingThreads() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return buildingThreads;
+    }
+
+    TranslationOutput::ErrorCode buildResult = TranslationOutput::ErrorCode::Success;
+    bool blocked = false;
+    std::thread::id neverBlockedThread;
+
+  protected:
+    std::mutex mtx;
+    std::condition_variable released;
+    std::vector<std::string> builtSources;
+    std::vector<std::thread::id> buildingThreads;
+};
+
+TranslationInput createInput(const std::string &src) {
+    TranslationInput input = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    input.src = ArrayRef<const char>(src.c_str(), src.size());
+    return input;
+}
+
+void waitUntilRunning(CompilerBuildPool::Job &job) {
+    while (CompilerBuildPool::Job::Status::Queued == job.getStatus()) {
+        std::this_thread::yield();
+    }
+}
+} // namespace
+
+struct CompilerBuildPoolTest : public ::testing::Test {
+    void SetUp() override {
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    }
+
+    std::unique_ptr<MockDevice> device;
+    BlockingCompilerInterface compilerInterface;
+};
+
+TEST_F(CompilerBuildPoolTest, givenSubmittedBuildWhenWaitingForJobThenCompilerOutputIsReturned) {
+    CompilerBuildPool buildPool(2U);
+    EXPECT_EQ(2U, buildPool.getMaxThreadsCount());
+    EXPECT_EQ(0U, buildPool.getThreadsCount());
+
+    std::string src = "kernel source";
+    auto job = buildPool.submit(compilerInterface, *device, createInput(src));
+    src = "modified after submit";
+    EXPECT_EQ(1U, buildPool.getThreadsCount());
+
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, job->getErrorCode());
+
+    TranslationOutput output;
+    job->copyOutput(output);
+    ASSERT_EQ(strlen("kernel source"), output.deviceBinary.size);
+    EXPECT_EQ(0, memcmp("kernel source", output.deviceBinary.mem.get(), output.deviceBinary.size));
+    EXPECT_STREQ("built", output.backendCompilerLog.c_str());
+}
+
+TEST_F(CompilerBuildPoolTest, givenFailingBuildWhenWaitingForJobThenCompilerErrorIsReturned) {
+    compilerInterface.buildResult = TranslationOutput::ErrorCode::BuildFailure;
+    CompilerBuildPool buildPool(1U);
+
+    std::string src = "kernel source";
+    auto job = buildPool.submit(compilerInterface, *device, createInput(src));
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    EXPECT_EQ(TranslationOutput::ErrorCode::BuildFailure, job->getErrorCode());
+}
+
+TEST_F(CompilerBuildPoolTest, givenIdenticalBuildInFlightWhenSubmittingThenInFlightJobIsReturnedAndInputIsCompiledOnce) {
+    compilerInterface.blocked = true;
+    CompilerBuildPool buildPool(2U);
+
+    std::string src = "kernel source";
+    auto firstJob = buildPool.submit(compilerInterface, *device, createInput(src));
+    auto secondJob = buildPool.submit(compilerInterface, *device, createInput(src));
+    EXPECT_EQ(firstJob, secondJob);
+
+    std::string otherSrc = "other kernel source";
+    auto otherJob = buildPool.submit(compilerInterface, *device, createInput(otherSrc));
+    EXPECT_NE(firstJob, otherJob);
+
+    compilerInterface.unblock();
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, firstJob->wait());
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, otherJob->wait());
+    EXPECT_EQ(2U, compilerInterface.getBuiltSources().size());
+
+    TranslationOutput firstOutput;
+    TranslationOutput secondOutput;
+    firstJob->copyOutput(firstOutput);
+    secondJob->copyOutput(secondOutput);
+    EXPECT_NE(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get());
+    EXPECT_EQ(firstOutput.deviceBinary.size, secondOutput.deviceBinary.size);
+}
+
+TEST_F(CompilerBuildPoolTest, givenCompletedBuildWhenSubmittingIdenticalBuildThenNewJobIsCreated) {
+    CompilerBuildPool buildPool(1U);
+
+    std::string src = "kernel source";
+    auto firstJob = buildPool.submit(compilerInterface, *device, createInput(src));
+    firstJob->wait();
+    auto secondJob = buildPool.submit(compilerInterface, *device, createInput(src));
+    secondJob->wait();
+
+    EXPECT_NE(firstJob, secondJob);
+    EXPECT_EQ(2U, compilerInterface.getBuiltSources().size());
+}
+
+TEST_F(CompilerBuildPoolTest, givenQueuedJobsWhenWorkerIsAvailableThenJobsAreBuiltInSubmissionOrder) {
+    compilerInterface.blocked = true;
+    CompilerBuildPool buildPool(1U);
+
+    std::string sources[] = {"running", "first", "second", "third"};
+    auto runningJob = buildPool.submit(compilerInterface, *device, createInput(sources[0]));
+    waitUntilRunning(*runningJob);
+
+    std::vector<std::shared_ptr<CompilerBuildPool::Job>> jobs;
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[1])));
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[2])));
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[3])));
+    EXPECT_EQ(3U, buildPool.getNumQueuedJobs());
+
+    compilerInterface.unblock();
+    for (auto &job : jobs) {
+        EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    }
+
+    std::vector<std::string> expectedOrder = {"running", "first", "second", "third"};
+    EXPECT_EQ(expectedOrder, compilerInterface.getBuiltSources());
+}
+
+TEST_F(CompilerBuildPoolTest, givenQueuedJobsWhenPoolIsDestroyedThenQueuedJobsAreCancelled) {
+    compilerInterface.blocked = true;
+    auto buildPool = std::make_unique<CompilerBuildPool>(1U);
+
+    std::string sources[] = {"running", "queued"};
+    auto runningJob = buildPool->submit(compilerInterface, *device, createInput(sources[0]));
+    waitUntilRunning(*runningJob);
+    auto queuedJob = buildPool->submit(compilerInterface, *device, createInput(sources[1]));
+
+    std::thread unblockingThread([&]() {
+        while (CompilerBuildPool::Job::Status::Queued == queuedJob->getStatus()) {
+            std::this_thread::yield();
+        }
+        compilerInterface.unblock();
+    });
+    buildPool.reset();
+    unblockingThread.join();
+
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, runningJob->getStatus());
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Cancelled, queuedJob->getStatus());
+    EXPECT_EQ(1U, compilerInterface.getBuiltSources().size());
+}
+
+TEST_F(CompilerBuildPoolTest, givenInputWithSpecConstantsOrGtpinWhenGettingDeduplicationKeyThenKeyIsEmpty) {
+    std::string src = "kernel source";
+    auto input = createInput(src);
+    EXPECT_FALSE(CompilerBuildPool::getDeduplicationKey(*device, input).empty());
+
+    auto specConstInput = input;
+    specConstInput.specializedValues[1U] = 2U;
+    EXPECT_TRUE(CompilerBuildPool::getDeduplicationKey(*device, specConstInput).empty());
+
+    int gtpinInit = 0;
+    auto gtpinInput = input;
+    gtpinInput.GTPinInput = &gtpinInit;
+    EXPECT_TRUE(CompilerBuildPool::getDeduplicationKey(*device, gtpinInput).empty());
+}
+
+TEST_F(CompilerBuildPoolTest, givenInputsDifferingInTypesOrOptionsWhenGettingDeduplicationKeyThenKeysDiffer) {
+    std::string src = "kernel source";
+    std::string options = "-cl-opt-disable";
+    auto input = createInput(src);
+    auto key = CompilerBuildPool::getDeduplicationKey(*device, input);
+
+    auto otherOutTypeInput = input;
+    otherOutTypeInput.outType = IGC::CodeType::llvmBc;
+    EXPECT_NE(key, CompilerBuildPool::getDeduplicationKey(*device, otherOutTypeInput));
+
+    auto otherOptionsInput = input;
+    otherOptionsInput.apiOptions = ArrayRef<const char>(options.c_str(), options.size());
+    EXPECT_NE(key, CompilerBuildPool::getDeduplicationKey(*device, otherOptionsInput));
+}
+
+TEST_F(CompilerBuildPoolTest, givenBusyWorkersWhenSubmittingJobsThenWorkersAreStartedUpToMaxThreadsCount) {
+    compilerInterface.blocked = true;
+    CompilerBuildPool buildPool(2U);
+
+    std::string sources[] = {"first", "second", "third"};
+    std::vector<std::shared_ptr<CompilerBuildPool::Job>> jobs;
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[0])));
+    waitUntilRunning(*jobs[0]);
+    EXPECT_EQ(1U, buildPool.getThreadsCount());
+
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[1])));
+    EXPECT_EQ(2U, buildPool.getThreadsCount());
+
+    jobs.push_back(buildPool.submit(compilerInterface, *device, createInput(sources[2])));
+    EXPECT_EQ(2U, buildPool.getThreadsCount());
+
+    compilerInterface.unblock();
+    for (auto &job : jobs) {
+        EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    }
+}
+
+TEST_F(CompilerBuildPoolTest, whenBuildingThenInputIsCompiledOnCallingThreadWithoutStartingWorkers) {
+    CompilerBuildPool buildPool(2U);
+
+    std::string src = "kernel source";
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, buildPool.build(compilerInterface, *device, createInput(src), output));
+    EXPECT_EQ(0U, buildPool.getThreadsCount());
+
+    ASSERT_EQ(1U, compilerInterface.getBuildingThreads().size());
+    EXPECT_EQ(std::this_thread::get_id(), compilerInterface.getBuildingThreads()[0]);
+    ASSERT_EQ(src.size(), output.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(src.c_str(), output.deviceBinary.mem.get(), output.deviceBinary.size));
+    EXPECT_STREQ("built", output.backendCompilerLog.c_str());
+}
+
+TEST_F(CompilerBuildPoolTest, givenBuildInProgressWhenSubmittingIdenticalBuildThenInProgressBuildIsReturnedAndInputIsCompiledOnce) {
+    compilerInterface.blocked = true;
+    CompilerBuildPool buildPool(1U);
+
+    std::string src = "kernel source";
+    TranslationOutput output;
+    auto buildErr = TranslationOutput::ErrorCode::UnknownError;
+    std::thread buildingThread([&]() {
+        buildErr = buildPool.build(compilerInterface, *device, createInput(src), output);
+    });
+    while (compilerInterface.getBuiltSources().empty()) {
+        std::this_thread::yield();
+    }
+
+    auto job = buildPool.submit(compilerInterface, *device, createInput(src));
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Running, job->getStatus());
+    EXPECT_EQ(0U, buildPool.getThreadsCount());
+
+    compilerInterface.unblock();
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    buildingThread.join();
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, buildErr);
+    EXPECT_EQ(src.size(), output.deviceBinary.size);
+    EXPECT_EQ(1U, compilerInterface.getBuiltSources().size());
+}
+
+TEST_F(CompilerBuildPoolTest, givenQueuedJobWhenWaitingForItThenJobIsCompiledOnCallingThread) {
+    compilerInterface.blocked = true;
+    compilerInterface.neverBlockedThread = std::this_thread::get_id();
+    CompilerBuildPool buildPool(1U);
+
+    std::string sources[] = {"running", "queued"};
+    auto runningJob = buildPool.submit(compilerInterface, *device, createInput(sources[0]));
+    waitUntilRunning(*runningJob);
+    auto queuedJob = buildPool.submit(compilerInterface, *device, createInput(sources[1]));
+
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, buildPool.wait(queuedJob));
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, queuedJob->getStatus());
+    EXPECT_EQ(0U, buildPool.getNumQueuedJobs());
+
+    std::vector<std::string> expectedSources = {"running", "queued"};
+    EXPECT_EQ(expectedSources, compilerInterface.getBuiltSources());
+    EXPECT_EQ(std::this_thread::get_id(), compilerInterface.getBuildingThreads()[1]);
+
+    compilerInterface.unblock();
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, buildPool.wait(runningJob));
+}
+
+TEST_F(CompilerBuildPoolTest, givenIdenticalQueuedJobWhenBuildingThenQueuedJobIsCompiledOnCallingThreadAndItsOutputIsReturned) {
+    compilerInterface.blocked = true;
+    compilerInterface.neverBlockedThread = std::this_thread::get_id();
+    CompilerBuildPool buildPool(1U);
+
+    std::string sources[] = {"running", "shared"};
+    auto runningJob = buildPool.submit(compilerInterface, *device, createInput(sources[0]));
+    waitUntilRunning(*runningJob);
+    auto sharedJob = buildPool.submit(compilerInterface, *device, createInput(sources[1]));
+
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, buildPool.build(compilerInterface, *device, createInput(sources[1]), output));
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, sharedJob->getStatus());
+    EXPECT_EQ(sources[1].size(), output.deviceBinary.size);
+
+    std::vector<std::string> expectedSources = {"running", "shared"};
+    EXPECT_EQ(expectedSources, compilerInterface.getBuiltSources());
+
+    compilerInterface.unblock();
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, runningJob->wait());
+}
+
+TEST_F(CompilerBuildPoolTest, givenSameInputForDifferentCompilerInterfacesWhenSubmittingThenJobsAreNotDeduplicated) {
+    compilerInterface.blocked = true;
+    BlockingCompilerInterface otherCompilerInterface;
+    CompilerBuildPool buildPool(1U);
+
+    std::string src = "kernel source";
+    auto job = buildPool.submit(compilerInterface, *device, createInput(src));
+    auto otherJob = buildPool.submit(otherCompilerInterface, *device, createInput(src));
+    EXPECT_NE(job, otherJob);
+
+    compilerInterface.unblock();
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, job->wait());
+    EXPECT_EQ(CompilerBuildPool::Job::Status::Completed, otherJob->wait());
+    EXPECT_EQ(1U, otherCompilerInterface.getBuiltSources().size());
+}
+
+TEST_F(CompilerBuildPoolTest, whenGettingCompilerBuildPoolFromExecutionEnvironmentThenPoolIsCreatedOnceAndNoThreadsAreStarted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CompilerBuildPoolThreads.set(2);
+
+    auto executionEnvironment = device->getExecutionEnvironment();
+    auto buildPool = executionEnvironment->getCompilerBuildPool();
+    ASSERT_NE(nullptr, buildPool);
+    EXPECT_EQ(2U, buildPool->getMaxThreadsCount());
+    EXPECT_EQ(0U, buildPool->getThreadsCount());
+    EXPECT_EQ(buildPool, executionEnvironment->getCompilerBuildPool());
+}
+
+TEST(CompilerBuildPoolThreadsTest, givenCompilerBuildPoolThreadsFlagWhenGettingDefaultThreadsCountThenFlagIsUsed) {
+    DebugManagerStateRestore restorer;
+    auto expectedDefaultThreadsCount = std::min(static_cast<size_t>(std::max(1U, std::thread::hardware_concurrency())), CompilerBuildPool::maxDefaultThreadsCount);
+    EXPECT_EQ(expectedDefaultThreadsCount, CompilerBuildPool::getDefaultThreadsCount());
+
+    DebugManager.flags.CompilerBuildPoolThreads.set(16);
+    EXPECT_EQ(16U, CompilerBuildPool::getDefaultThreadsCount());
+
+    DebugManager.flags.CompilerBuildPoolThreads.set(0);
+    EXPECT_EQ(1U, CompilerBuildPool::getDefaultThreadsCount());
+}
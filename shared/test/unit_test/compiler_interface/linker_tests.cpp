@@ -218,6 +218,44 @@ TEST(LinkerInputTests, givenRelocationTableThenRelocationEntriesAreProperlyParse
     EXPECT_TRUE(linkerInput.isValid());
 }
 
+TEST(LinkerInputTests, givenSymbolAndRelocationTablesThenSymbolNamesAreInternedToTheSameIds) {
+    NEO::LinkerInput linkerInput;
+    vISA::GenSymEntry symbol = {};
+    symbol.s_name[0] = 'A';
+    symbol.s_name[1] = 'x';
+    symbol.s_type = vISA::GenSymType::S_FUNC;
+    symbol.s_offset = 8;
+    symbol.s_size = 16;
+    vISA::GenRelocEntry relocation = {};
+    relocation.r_symbol[0] = 'A';
+    relocation.r_symbol[1] = 'x';
+    relocation.r_offset = 8;
+    relocation.r_type = vISA::GenRelocType::R_SYM_ADDR;
+
+    EXPECT_TRUE(linkerInput.decodeExportedFunctionsSymbolTable(&symbol, 1, 0));
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocation, 1, 0));
+
+    auto symbolId = linkerInput.getSymbolNames().find("Ax");
+    EXPECT_NE(NEO::invalidSymbolId, symbolId);
+    EXPECT_EQ(1U, linkerInput.getSymbolNames().size());
+    EXPECT_EQ("Ax", linkerInput.getSymbolNames().getName(symbolId));
+    EXPECT_EQ(symbolId, linkerInput.getSymbols().find("Ax")->second.symbolId);
+    EXPECT_EQ(symbolId, linkerInput.getRelocationsInInstructionSegments()[0][0].symbolId);
+    EXPECT_EQ(NEO::invalidSymbolId, linkerInput.getSymbolNames().find("Ay"));
+}
+
+TEST(SymbolNameTableTests, whenInterningNamesThenIdsAreDenseAndStableForSameName) {
+    NEO::SymbolNameTable symbolNames;
+    EXPECT_EQ(NEO::invalidSymbolId, symbolNames.find("A"));
+
+    EXPECT_EQ(0U, symbolNames.intern("A"));
+    EXPECT_EQ(1U, symbolNames.intern("B"));
+    EXPECT_EQ(0U, symbolNames.intern("A"));
+    EXPECT_EQ(2U, symbolNames.size());
+    EXPECT_EQ(1U, symbolNames.find("B"));
+    EXPECT_EQ("B", symbolNames.getName(1U));
+}
+
 TEST(LinkerInputTests, givenRelocationTableThenNoneAsRelocationTypeIsNotAllowed) {
     NEO::LinkerInput linkerInput;
     vISA::GenRelocEntry entry = {};
@@ -331,6 +369,42 @@ TEST(LinkerTests, givenUnresolvedExternalWhenPatchingInstructionsThenLinkPartial
     EXPECT_EQ(std::string(entry.r_symbol), std::string(unresolvedExternals[0].unresolvedRelocation.symbolName));
 }
 
+TEST(LinkerTests, givenSymbolsFilledWithoutIdsWhenPatchingInstructionsThenTheyAreMatchedWithDecodedRelocationsByName) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    vISA::GenRelocEntry entry = {};
+    entry.r_symbol[0] = 'A';
+    entry.r_offset = 8;
+    entry.r_type = vISA::GenRelocType::R_SYM_ADDR;
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&entry, 1, 0));
+
+    // unlisted symbol must not alias id of any name from LinkerInput's table
+    linkerInput.symbols["B"].segment = NEO::SegmentType::Instructions;
+    linkerInput.symbols["B"].offset = 0U;
+    linkerInput.symbols["B"].size = 8U;
+    linkerInput.symbols["A"].segment = NEO::SegmentType::Instructions;
+    linkerInput.symbols["A"].offset = 16U;
+    linkerInput.symbols["A"].size = 8U;
+
+    NEO::Linker linker(linkerInput);
+    NEO::Linker::SegmentInfo globalVar, globalConst, exportedFunc;
+    exportedFunc.gpuAddress = 4096U;
+    exportedFunc.segmentSize = 64U;
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+
+    std::vector<char> instructionSegment(64, 0);
+    NEO::Linker::PatchableSegment seg0;
+    seg0.hostPointer = instructionSegment.data();
+    seg0.segmentSize = instructionSegment.size();
+    NEO::Linker::PatchableSegments patchableInstructionSegments{seg0};
+
+    auto linkResult = linker.link(globalVar, globalConst, exportedFunc,
+                                  nullptr, nullptr, patchableInstructionSegments,
+                                  unresolvedExternals, nullptr, nullptr, nullptr);
+    EXPECT_EQ(NEO::LinkingStatus::LinkedFully, linkResult);
+    EXPECT_EQ(0U, unresolvedExternals.size());
+    EXPECT_EQ(exportedFunc.gpuAddress + 16U, *reinterpret_cast<uintptr_t *>(instructionSegment.data() + entry.r_offset));
+}
+
 TEST(LinkerTests, givenValidSymbolsAndRelocationsThenInstructionSegmentsAreProperlyPatched) {
     NEO::LinkerInput linkerInput;
 
@@ -1042,6 +1116,29 @@ TEST(LinkerTests, GivenAllocationInLocalMemoryWhichRequiresBlitterWhenPatchingDa
     }
 }
 
+TEST(LinkerTests, givenPatchPlanWhenApplyingThenEveryEntryIsPatchedInItsInstructionsSegment) {
+    uint64_t segment0[2] = {};
+    uint32_t segment1[4] = {};
+    NEO::Linker::PatchableSegments instructionsSegments;
+    instructionsSegments.push_back({segment0, sizeof(segment0)});
+    instructionsSegments.push_back({segment1, sizeof(segment1)});
+
+    uintptr_t gpuAddress = static_cast<uintptr_t>(0x1234567890ULL & std::numeric_limits<uintptr_t>::max());
+    NEO::Linker::PatchPlan patchPlan;
+    patchPlan.push_back({sizeof(uint64_t), gpuAddress, NEO::LinkerInput::RelocationInfo::Type::AddressLow, 0U});
+    patchPlan.push_back({0U, gpuAddress, NEO::LinkerInput::RelocationInfo::Type::AddressHigh, 1U});
+    patchPlan.push_back({2 * sizeof(uint32_t), gpuAddress, NEO::LinkerInput::RelocationInfo::Type::AddressLow, 1U});
+    NEO::Linker::applyPatchPlan(patchPlan, instructionsSegments);
+
+    uint64_t gpuAddressAs64bit = static_cast<uint64_t>(gpuAddress);
+    EXPECT_EQ(0U, segment0[0]);
+    EXPECT_EQ(static_cast<uint32_t>(gpuAddressAs64bit & 0xffffffff), *reinterpret_cast<uint32_t *>(&segment0[1]));
+    EXPECT_EQ(static_cast<uint32_t>((gpuAddressAs64bit >> 32) & 0xffffffff), segment1[0]);
+    EXPECT_EQ(0U, segment1[1]);
+    EXPECT_EQ(static_cast<uint32_t>(gpuAddressAs64bit & 0xffffffff), segment1[2]);
+    EXPECT_EQ(0U, segment1[3]);
+}
+
 TEST(LinkerErrorMessageTests, whenListOfUnresolvedExternalsIsEmptyThenErrorTypeDefaultsToInternalError) {
     NEO::Linker::UnresolvedExternals unresolvedExternals;
     std::vector<std::string> segmentsNames{"kernel1", "kernel2"};
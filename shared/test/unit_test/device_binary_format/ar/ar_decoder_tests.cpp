@@ -6,9 +6,12 @@
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
 
 #include "test.h"
 
+#include <cstring>
+
 using namespace NEO::Ar;
 
 TEST(ArDecoderIsAr, WhenNotArThenReturnsFalse) {
@@ -425,3 +428,72 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderFindIndexedFile, GivenArchiveWithIndexThenReturnsListedFileEntry) {
+    const uint8_t data0[4] = "123";
+    const uint8_t data1[8] = "9ABCDEF";
+    ArEncoder encoder(true, true);
+    encoder.appendFileEntry("a", data0);
+    encoder.appendFileEntry("bb", data1);
+    auto arData = encoder.encode();
+
+    auto file = findIndexedFile(arData, "bb");
+    ASSERT_NE(nullptr, file.fullHeader);
+    EXPECT_EQ(NEO::ConstStringRef("bb"), file.fileName);
+    ASSERT_EQ(sizeof(data1), file.fileData.size());
+    EXPECT_EQ(0, memcmp(data1, file.fileData.begin(), sizeof(data1)));
+
+    file = findIndexedFile(arData, "a");
+    ASSERT_NE(nullptr, file.fullHeader);
+    EXPECT_EQ(NEO::ConstStringRef("a"), file.fileName);
+    ASSERT_EQ(sizeof(data0), file.fileData.size());
+    EXPECT_EQ(0, memcmp(data0, file.fileData.begin(), sizeof(data0)));
+
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "b").fullHeader);
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "c").fullHeader);
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_NE(nullptr, ar.magic);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    ASSERT_EQ(4U, ar.files.size());
+    EXPECT_EQ(SpecialFileNames::indexFile, ar.files[0].fileName);
+}
+
+TEST(ArDecoderFindIndexedFile, GivenArchiveWithoutIndexThenReturnsEmptyEntry) {
+    const uint8_t data0[4] = "123";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", data0);
+    auto arData = encoder.encode();
+
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "a").fullHeader);
+    EXPECT_EQ(nullptr, findIndexedFile({}, "a").fullHeader);
+}
+
+TEST(ArDecoderFindIndexedFile, GivenIndexPointingToOtherFileEntryThenReturnsEmptyEntry) {
+    const uint8_t data0[4] = "123";
+    const uint8_t data1[4] = "456";
+    ArEncoder encoder(false, true);
+    encoder.appendFileEntry("a", data0);
+    encoder.appendFileEntry("b", data1);
+    auto arData = encoder.encode();
+
+    auto indexData = reinterpret_cast<char *>(arData.data() + arMagic.size() + sizeof(ArFileEntryHeader));
+    indexData[0] = 'b';
+    indexData[2 + indexOffsetDigits + 1] = 'a';
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "a").fullHeader);
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "b").fullHeader);
+}
+
+TEST(ArDecoderFindIndexedFile, GivenIndexWithOutOfBoundsOffsetThenReturnsEmptyEntry) {
+    const uint8_t data0[4] = "123";
+    ArEncoder encoder(false, true);
+    encoder.appendFileEntry("a", data0);
+    auto arData = encoder.encode();
+
+    auto indexData = reinterpret_cast<char *>(arData.data() + arMagic.size() + sizeof(ArFileEntryHeader));
+    indexData[2] = '9';
+    EXPECT_EQ(nullptr, findIndexedFile(arData, "a").fullHeader);
+}
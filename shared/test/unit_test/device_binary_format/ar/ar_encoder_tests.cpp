@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/device_binary_format/ar/ar_decoder.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
@@ -148,3 +149,44 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenIndexRequestedThenIndexFileIsEncodedFirstAndListsFileEntryHeaderOffsets) {
+    ConstStringRef fileName0 = "a";
+    ConstStringRef fileName1 = "bb";
+    const uint8_t data0[4] = "123";
+    const uint8_t data1[8] = "9ABCDEF";
+    ArEncoder encoder(true, true);
+
+    encoder.appendFileEntry(fileName0, data0);
+    encoder.appendFileEntry(fileName1, data1);
+
+    auto arData = encoder.encode();
+    EXPECT_TRUE(NEO::hasSameMagic(arMagic, arData));
+    ArFileEntryHeader *index = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size());
+    EXPECT_EQ(ConstStringRef("ar_index/       ", 16), ConstStringRef::fromArray(index->identifier));
+    auto indexSize = readDecimal<sizeof(index->fileSizeInBytes)>(index->fileSizeInBytes);
+    EXPECT_EQ(0U, (sizeof(ArFileEntryHeader) + indexSize) % 8);
+
+    ConstStringRef indexData(reinterpret_cast<const char *>(index + 1), static_cast<size_t>(indexSize));
+    auto file0HeaderOffset = std::stoull(std::string(indexData.begin() + fileName0.size() + 1, indexOffsetDigits));
+    auto file1HeaderOffset = std::stoull(std::string(indexData.begin() + fileName0.size() + indexOffsetDigits + 2 + fileName1.size() + 1, indexOffsetDigits));
+    EXPECT_EQ(ConstStringRef("a "), ConstStringRef(indexData.begin(), 2));
+    EXPECT_EQ(ConstStringRef("bb "), ConstStringRef(indexData.begin() + fileName0.size() + indexOffsetDigits + 2, 3));
+
+    ASSERT_LT(file0HeaderOffset, arData.size());
+    ASSERT_LT(file1HeaderOffset, arData.size());
+    EXPECT_EQ(0U, (file0HeaderOffset + sizeof(ArFileEntryHeader)) % 8);
+    EXPECT_EQ(0U, (file1HeaderOffset + sizeof(ArFileEntryHeader)) % 8);
+    EXPECT_EQ(0, memcmp(arData.data() + file0HeaderOffset + sizeof(ArFileEntryHeader), data0, sizeof(data0)));
+    EXPECT_EQ(0, memcmp(arData.data() + file1HeaderOffset + sizeof(ArFileEntryHeader), data1, sizeof(data1)));
+}
+
+TEST(ArEncoder, GivenIndexNotRequestedThenIndexFileIsNotEncoded) {
+    const uint8_t data0[4] = "123";
+    ArEncoder encoder(true);
+    encoder.appendFileEntry("a", data0);
+
+    auto arData = encoder.encode();
+    ArFileEntryHeader *firstFile = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size());
+    EXPECT_NE(ConstStringRef("ar_index/       ", 16), ConstStringRef::fromArray(firstFile->identifier));
+}
@@ -84,6 +84,35 @@ TEST(UnpackSingleDeviceBinaryAr, WhenMultipleBinariesMatchedThenChooseBestMatch)
     EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
 }
 
+TEST(UnpackSingleDeviceBinaryAr, GivenArWithIndexWhenMultipleBinariesMatchedThenChooseBestMatchUsingIndex) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::Ar::ArEncoder encoder(true, true);
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize, programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct, programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+
+    auto indexedFile = NEO::Ar::findIndexedFile(arData, requiredPointerSize + "." + requiredProduct + "." + requiredStepping);
+    ASSERT_NE(nullptr, indexedFile.fullHeader);
+    EXPECT_EQ(unpacked.deviceBinary.begin(), indexedFile.fileData.begin());
+    EXPECT_EQ(unpacked.deviceBinary.size(), indexedFile.fileData.size());
+    EXPECT_EQ(NEO::DeviceBinaryFormat::Patchtokens, unpacked.format);
+}
+
 TEST(UnpackSingleDeviceBinaryAr, WhenBestMatchIsntFullMatchThenChooseBestMatchButEmitWarnings) {
     PatchTokensTestData::ValidEmptyProgram programTokens;
     NEO::Ar::ArEncoder encoder;
@@ -7,6 +7,7 @@
 
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/helpers/hash.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "test.h"
 
@@ -1190,6 +1191,91 @@ TEST(ProgramDecoder, GivenValidProgramWithTwoKernelsWhenThenDecodingSucceeds) {
     EXPECT_NE(nullptr, decodedKernel1.tokens.allocateLocalSurface);
 }
 
+TEST(ProgramDecoder, GivenMultipleDecodeThreadsWhenDecodingProgramWithManyKernelsThenKernelsAreDecodedInBlobOrder) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(4);
+
+    constexpr uint32_t numKernels = 100U;
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_TRUE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.decodeStatus);
+    ASSERT_EQ(numKernels, decodedProgram.kernels.size());
+
+    auto firstKernel = programToEncode.storage.data() + programToEncode.kernOffset;
+    for (uint32_t i = 0; i < numKernels; ++i) {
+        auto &decodedKernel = decodedProgram.kernels[i];
+        EXPECT_EQ(NEO::DecodeError::Success, decodedKernel.decodeStatus);
+        EXPECT_EQ(ptrOffset(firstKernel, i * kernelBlob.size()), decodedKernel.blobs.kernelInfo.begin());
+        EXPECT_EQ(kernelBlob.size(), decodedKernel.blobs.kernelInfo.size());
+        EXPECT_NE(nullptr, decodedKernel.tokens.allocateLocalSurface);
+    }
+}
+
+TEST(ProgramDecoder, GivenMultipleDecodeThreadsWhenFailsToDecodeKernelThenKernelsFollowingFirstInvalidOneAreDropped) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(4);
+
+    constexpr uint32_t numKernels = 100U;
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    programToEncode.headerMutable->NumberOfKernels = numKernels;
+    for (uint32_t i = 1; i < numKernels; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+    for (auto invalidKernel : {70U, 30U}) {
+        auto slmToken = reinterpret_cast<iOpenCL::SPatchAllocateLocalSurface *>(programToEncode.storage.data() + programToEncode.slmMutableOffset + invalidKernel * kernelBlob.size());
+        slmToken->Size = 0U;
+    }
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_FALSE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(31U, decodedProgram.kernels.size());
+    for (uint32_t i = 0; i < 30U; ++i) {
+        EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.kernels[i].decodeStatus);
+    }
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[30].decodeStatus);
+}
+
+TEST(ProgramDecoder, GivenMultipleDecodeThreadsWhenBlobDoesntHaveEnoughSpaceForAllKernelsThenDecodingFailsOnFirstMissingKernel) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(4);
+
+    PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
+    std::vector<uint8_t> kernelBlob(programToEncode.kernels[0].blobs.kernelInfo.begin(), programToEncode.kernels[0].blobs.kernelInfo.end());
+    programToEncode.headerMutable->NumberOfKernels = 10U;
+    for (uint32_t i = 1; i < 5U; ++i) {
+        programToEncode.storage.insert(programToEncode.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    }
+
+    NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram;
+    bool decodeSuccess = NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(programToEncode.storage, decodedProgram);
+    EXPECT_FALSE(decodeSuccess);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.decodeStatus);
+    ASSERT_EQ(6U, decodedProgram.kernels.size());
+    EXPECT_EQ(NEO::DecodeError::Success, decodedProgram.kernels[4].decodeStatus);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, decodedProgram.kernels[5].decodeStatus);
+}
+
+TEST(ProgramDecoder, GivenDefaultSettingsThenKernelsAreDecodedInParallelOnlyForLargePrograms) {
+    EXPECT_EQ(0U, NEO::PatchTokenBinary::getKernelsDecodeThreadsCount(NEO::PatchTokenBinary::minKernelsPerDecodeThread - 1));
+    EXPECT_LE(1U, NEO::PatchTokenBinary::getKernelsDecodeThreadsCount(NEO::PatchTokenBinary::minKernelsPerDecodeThread * 2));
+
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(3);
+    EXPECT_EQ(2U, NEO::PatchTokenBinary::getKernelsDecodeThreadsCount(2));
+    EXPECT_EQ(3U, NEO::PatchTokenBinary::getKernelsDecodeThreadsCount(5));
+}
+
 TEST(ProgramDecoder, GivenPatchTokenWithZeroSizeThenDecodingFailsAndStops) {
     PatchTokensTestData::ValidProgramWithKernelUsingSlm programToEncode;
     programToEncode.slmMutable->Size = 0U;
@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/source/device_binary_format/patchtokens_validator.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -519,6 +520,43 @@ TEST(PatchtokensValidator, GivenKernelWhenExecutionEnvironmentHasInvalidSimdSize
     EXPECT_TRUE(warning.empty());
 }
 
+TEST(PatchtokensValidator, GivenMultipleValidationThreadsWhenManyKernelsAreInvalidThenResultMatchesSerialValidation) {
+    PatchTokensTestData::ValidProgramWithKernel prog;
+    prog.kernels.resize(100U, prog.kernels[0]);
+
+    iOpenCL::SPatchItemHeader unknownTokenA = {};
+    unknownTokenA.Token = iOpenCL::NUM_PATCH_TOKENS + 1;
+    iOpenCL::SPatchItemHeader unknownTokenB = {};
+    unknownTokenB.Token = iOpenCL::NUM_PATCH_TOKENS + 2;
+    prog.kernels[5].unhandledTokens.push_back(&unknownTokenA);
+    prog.kernels[30].decodeStatus = NEO::DecodeError::Undefined;
+    prog.kernels[40].unhandledTokens.push_back(&unknownTokenB);
+    prog.kernels[70].decodeStatus = NEO::DecodeError::InvalidBinary;
+
+    std::string serialError, serialWarning;
+    auto serialResult = NEO::PatchTokenBinary::validate(prog, serialError, serialWarning);
+    EXPECT_EQ(NEO::DecodeError::UnhandledBinary, serialResult);
+    EXPECT_STREQ("KernelFromPatchtokens wasn't successfully decoded", serialError.c_str());
+    auto expectedWarning = "Unknown kernel-scope Patch Token : " + std::to_string(unknownTokenA.Token);
+    EXPECT_STREQ(expectedWarning.c_str(), serialWarning.c_str());
+
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(4);
+    std::string error, warning;
+    EXPECT_EQ(serialResult, NEO::PatchTokenBinary::validate(prog, error, warning));
+    EXPECT_EQ(serialError, error);
+    EXPECT_EQ(serialWarning, warning);
+
+    prog.kernels[30].decodeStatus = NEO::DecodeError::Success;
+    prog.kernels[70].decodeStatus = NEO::DecodeError::Success;
+    error.clear();
+    warning.clear();
+    EXPECT_EQ(NEO::DecodeError::Success, NEO::PatchTokenBinary::validate(prog, error, warning));
+    EXPECT_TRUE(error.empty());
+    expectedWarning = "Unknown kernel-scope Patch Token : " + std::to_string(unknownTokenB.Token);
+    EXPECT_STREQ(expectedWarning.c_str(), warning.c_str());
+}
+
 TEST(PatchtokensValidator, GivenDefaultStateThenUnhandledPatchtokensAreAllowed) {
     EXPECT_TRUE(NEO::PatchTokenBinary::allowUnhandledTokens);
 }
@@ -1955,6 +1955,72 @@ kernels:
     EXPECT_EQ(32, programInfo.kernelInfos[1]->kernelDescriptor.kernelAttributes.simdSize);
 }
 
+TEST(DecodeSingleDeviceBinaryZebin, GivenMultipleDecodeThreadsThenKernelsArePopulatedInZeInfoOrder) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.ZebinDecodeThreads.set(4);
+
+    constexpr size_t numKernels = 100U;
+    std::string validZeInfo = std::string("version :\'") + toString(zeInfoDecoderVersion) + "\'\nkernels:\n";
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+    for (size_t i = 0; i < numKernels; ++i) {
+        auto kernelName = "kernel_" + std::to_string(i);
+        validZeInfo += "    - name : " + kernelName + "\n      execution_env :\n        simd_size : " + ((i % 2) ? "8" : "16") + "\n";
+        zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + kernelName, {});
+    }
+    zebin.appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(validZeInfo.data(), validZeInfo.size()));
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::Success, error);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+
+    ASSERT_EQ(numKernels, programInfo.kernelInfos.size());
+    for (size_t i = 0; i < numKernels; ++i) {
+        EXPECT_EQ("kernel_" + std::to_string(i), programInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ((i % 2) ? 8 : 16, programInfo.kernelInfos[i]->kernelDescriptor.kernelAttributes.simdSize);
+    }
+}
+
+TEST(DecodeSingleDeviceBinaryZebin, GivenMultipleDecodeThreadsAndInvalidKernelsThenFirstInvalidKernelErrorIsReported) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.ZebinDecodeThreads.set(4);
+
+    std::string zeInfo = std::string("version :\'") + toString(zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+    - name : missing_text_kernel
+      execution_env :
+        simd_size : 8
+    - name : other_missing_text_kernel
+      execution_env :
+        simd_size : 8
+)===";
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+    zebin.appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", {});
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, error);
+    EXPECT_STREQ("DeviceBinaryFormat::Zebin : Could not find text section for kernel missing_text_kernel\n", decodeErrors.c_str());
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+    EXPECT_STREQ("some_kernel", programInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName.c_str());
+}
+
 TEST(PopulateKernelDescriptor, WhenValidationOfZeinfoSectionsCountFailsThenDecodingFails) {
     NEO::ConstStringRef zeinfo = R"===(
 kernels:
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/memory_manager/isa_heap_allocator.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "test.h"
+
+#include <algorithm>
+
+using namespace NEO;
+
+TEST(IsaHeapAllocatorTest, givenSmallChunksWhenAllocatingThenChunksArePackedIntoOneArenaWithoutOverlapping) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    IsaHeapAllocator isaHeapAllocator(*device);
+
+    size_t offsets[3] = {};
+    GraphicsAllocation *arenas[3] = {};
+    for (size_t i = 0; i < 3; i++) {
+        arenas[i] = isaHeapAllocator.allocate(100, offsets[i]);
+        ASSERT_NE(nullptr, arenas[i]);
+        EXPECT_EQ(0u, offsets[i] % IsaHeapAllocator::chunkAlignment);
+        EXPECT_LE(offsets[i] + 100, arenas[i]->getUnderlyingBufferSize());
+    }
+    EXPECT_EQ(arenas[0], arenas[1]);
+    EXPECT_EQ(arenas[0], arenas[2]);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::KERNEL_ISA, arenas[0]->getAllocationType());
+    EXPECT_EQ(1u, isaHeapAllocator.getArenasCount());
+    EXPECT_TRUE(isaHeapAllocator.isArenaAllocation(arenas[0]));
+
+    std::sort(std::begin(offsets), std::end(offsets));
+    EXPECT_LE(offsets[0] + 100, offsets[1]);
+    EXPECT_LE(offsets[1] + 100, offsets[2]);
+
+    for (auto offset : offsets) {
+        isaHeapAllocator.free(arenas[0], offset);
+    }
+}
+
+TEST(IsaHeapAllocatorTest, givenEmptyOrTooBigChunkWhenAllocatingThenNoArenaIsReturned) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    IsaHeapAllocator isaHeapAllocator(*device);
+
+    size_t offset = 0U;
+    EXPECT_EQ(nullptr, isaHeapAllocator.allocate(0U, offset));
+    EXPECT_EQ(nullptr, isaHeapAllocator.allocate(IsaHeapAllocator::maxChunkSize + 1, offset));
+    EXPECT_EQ(0u, isaHeapAllocator.getArenasCount());
+}
+
+TEST(IsaHeapAllocatorTest, givenChunkFreedWhileArenaIsUsedByGpuWhenAllocatingThenChunkIsReusedOnlyAfterGpuCompletes) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    IsaHeapAllocator isaHeapAllocator(*device);
+    auto &engine = device->getDefaultEngine();
+    auto contextId = engine.osContext->getContextId();
+
+    size_t firstOffset = 0U;
+    auto arena = isaHeapAllocator.allocate(100, firstOffset);
+    ASSERT_NE(nullptr, arena);
+
+    *engine.commandStreamReceiver->getTagAddress() = 1;
+    arena->updateTaskCount(2, contextId);
+    isaHeapAllocator.free(arena, firstOffset);
+
+    size_t secondOffset = 0U;
+    EXPECT_EQ(arena, isaHeapAllocator.allocate(100, secondOffset));
+    EXPECT_NE(firstOffset, secondOffset);
+
+    *engine.commandStreamReceiver->getTagAddress() = 2;
+    size_t thirdOffset = 0U;
+    EXPECT_EQ(arena, isaHeapAllocator.allocate(100, thirdOffset));
+    EXPECT_EQ(firstOffset, thirdOffset);
+
+    arena->releaseUsageInOsContext(contextId);
+    isaHeapAllocator.free(arena, secondOffset);
+    isaHeapAllocator.free(arena, thirdOffset);
+}
+
+TEST(IsaHeapAllocatorTest, givenFullArenaWhenAllocatingThenNewArenaIsCreated) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    IsaHeapAllocator isaHeapAllocator(*device);
+
+    size_t chunksPerArena = IsaHeapAllocator::arenaSize / IsaHeapAllocator::maxChunkSize;
+    size_t offset = 0U;
+    GraphicsAllocation *firstArena = nullptr;
+    for (size_t i = 0; i < chunksPerArena; i++) {
+        auto arena = isaHeapAllocator.allocate(IsaHeapAllocator::maxChunkSize, offset);
+        ASSERT_NE(nullptr, arena);
+        if (firstArena == nullptr) {
+            firstArena = arena;
+        }
+        EXPECT_EQ(firstArena, arena);
+    }
+    auto secondArena = isaHeapAllocator.allocate(IsaHeapAllocator::maxChunkSize, offset);
+    ASSERT_NE(nullptr, secondArena);
+    EXPECT_NE(firstArena, secondArena);
+    EXPECT_EQ(2u, isaHeapAllocator.getArenasCount());
+}
+
+TEST(IsaHeapAllocatorTest, givenSharedIsaHeapDebugFlagWhenCreatingDeviceThenIsaHeapAllocatorIsCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    EXPECT_EQ(nullptr, device->getIsaHeapAllocator());
+
+    DebugManager.flags.EnableSharedIsaHeap.set(1);
+    device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    EXPECT_NE(nullptr, device->getIsaHeapAllocator());
+}
@@ -15,6 +15,7 @@ MockDispatchKernelEncoder::MockDispatchKernelEncoder() {
     EXPECT_CALL(*this, getKernelDescriptor).WillRepeatedly(::testing::ReturnRef(kernelDescriptor));
 
     EXPECT_CALL(*this, getIsaAllocation).WillRepeatedly(Return(&mockAllocation));
+    EXPECT_CALL(*this, getIsaOffsetInParentAllocation).WillRepeatedly(Return(0u));
     EXPECT_CALL(*this, getCrossThreadDataSize).WillRepeatedly(Return(crossThreadSize));
     EXPECT_CALL(*this, getPerThreadDataSize).WillRepeatedly(Return(perThreadSize));
 
@@ -40,6 +40,7 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     MOCK_METHOD(uint32_t, getSurfaceStateHeapDataSize, (), (const, override));
 
     MOCK_METHOD(GraphicsAllocation *, getIsaAllocation, (), (const, override));
+    MOCK_METHOD(uint64_t, getIsaOffsetInParentAllocation, (), (const, override));
     MOCK_METHOD(const uint8_t *, getDynamicStateHeapData, (), (const, override));
 
     MOCK_METHOD(bool, requiresGenerationOfLocalIdsByRuntime, (), (const, override));
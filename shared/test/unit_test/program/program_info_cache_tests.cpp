@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/program/program_info.h"
+#include "shared/source/program/program_info_cache.h"
+#include "shared/test/unit_test/device_binary_format/zebin_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/mocks/mock_compiler_interface.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+
+using namespace NEO;
+
+namespace {
+struct ZebinWithKernels : ZebinTestData::ValidEmptyProgram {
+    ZebinWithKernels() {
+        std::string zeInfo = std::string("version :\'") + toString(zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+      payload_arguments :
+        - arg_type : arg_bypointer
+          offset : 0
+          size : 8
+          arg_index : 0
+          addrmode : stateful
+        - arg_type : arg_byvalue
+          offset : 8
+          size : 4
+          arg_index : 1
+      binding_table_indices :
+        - bti_value : 2
+          arg_index : 0
+    - name : some_other_kernel
+      execution_env :
+        simd_size : 32
+)===";
+        removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+        appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+        const uint8_t isa[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", isa);
+        appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_other_kernel", isa);
+        const uint8_t globals[] = {2, 3, 5, 7};
+        appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::dataGlobal, globals);
+    }
+
+    void decode(ProgramInfo &programInfo) {
+        SingleDeviceBinary singleBinary;
+        singleBinary.deviceBinary = storage;
+        std::string decodeErrors;
+        std::string decodeWarnings;
+        auto error = decodeSingleDeviceBinary<DeviceBinaryFormat::Zebin>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+        ASSERT_EQ(DecodeError::Success, error) << decodeErrors;
+    }
+};
+
+class ProgramInfoCacheMock : public CompilerCache {
+  public:
+    ProgramInfoCacheMock() : CompilerCache(CompilerCacheConfig{}) {
+    }
+
+    bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+        cacheInvoked++;
+        entries[kernelFileHash].assign(pBinary, pBinary + binarySize);
+        return true;
+    }
+
+    std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        loadInvoked++;
+        auto entry = entries.find(kernelFileHash);
+        if (entries.end() == entry) {
+            return nullptr;
+        }
+        cachedBinarySize = entry->second.size();
+        auto ret = std::make_unique<char[]>(cachedBinarySize);
+        memcpy(ret.get(), entry->second.data(), cachedBinarySize);
+        return ret;
+    }
+
+    std::map<std::string, std::vector<char>> entries;
+    uint32_t cacheInvoked = 0U;
+    uint32_t loadInvoked = 0U;
+};
+} // namespace
+
+TEST(ProgramInfoCacheTests, givenDecodedZebinWhenSerializedAndDeserializedThenProgramInfoIsRestored) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    ASSERT_EQ(2U, decoded.kernelInfos.size());
+
+    auto image = ProgramInfoCache::serialize(decoded, zebin.storage);
+    ASSERT_FALSE(image.empty());
+
+    ProgramInfo restored;
+    ASSERT_TRUE(ProgramInfoCache::deserialize(restored, image, zebin.storage));
+    EXPECT_EQ(decoded.globalVariables.initData, restored.globalVariables.initData);
+    EXPECT_EQ(decoded.globalVariables.size, restored.globalVariables.size);
+    EXPECT_EQ(nullptr, restored.globalConstants.initData);
+    EXPECT_EQ(nullptr, restored.linkerInput);
+    ASSERT_EQ(2U, restored.kernelInfos.size());
+
+    for (size_t i = 0; i < decoded.kernelInfos.size(); ++i) {
+        const auto &expected = *decoded.kernelInfos[i];
+        const auto &got = *restored.kernelInfos[i];
+        EXPECT_EQ(expected.kernelDescriptor.kernelMetadata.kernelName, got.kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(0, memcmp(&expected.kernelDescriptor.kernelAttributes, &got.kernelDescriptor.kernelAttributes, sizeof(got.kernelDescriptor.kernelAttributes)));
+        EXPECT_EQ(0, memcmp(&expected.kernelDescriptor.payloadMappings.dispatchTraits, &got.kernelDescriptor.payloadMappings.dispatchTraits, sizeof(got.kernelDescriptor.payloadMappings.dispatchTraits)));
+        EXPECT_EQ(expected.kernelDescriptor.payloadMappings.explicitArgs.size(), got.kernelDescriptor.payloadMappings.explicitArgs.size());
+        EXPECT_EQ(expected.kernelDescriptor.explicitArgsExtendedMetadata.size(), got.kernelDescriptor.explicitArgsExtendedMetadata.size());
+        EXPECT_EQ(expected.kernelDescriptor.generatedHeaps, got.kernelDescriptor.generatedHeaps);
+        EXPECT_EQ(expected.heapInfo.pKernelHeap, got.heapInfo.pKernelHeap);
+        EXPECT_EQ(expected.heapInfo.KernelHeapSize, got.heapInfo.KernelHeapSize);
+        EXPECT_EQ(expected.heapInfo.SurfaceStateHeapSize, got.heapInfo.SurfaceStateHeapSize);
+        if (0U != got.heapInfo.SurfaceStateHeapSize) {
+            EXPECT_EQ(ptrDiff(expected.heapInfo.pSsh, expected.kernelDescriptor.generatedHeaps.data()), ptrDiff(got.heapInfo.pSsh, got.kernelDescriptor.generatedHeaps.data()));
+        }
+    }
+
+    const auto &args = restored.kernelInfos[0]->kernelDescriptor.payloadMappings.explicitArgs;
+    ASSERT_EQ(2U, args.size());
+    EXPECT_EQ(128U, args[0].as<ArgDescPointer>().bindful);
+    ASSERT_TRUE(args[1].is<ArgDescriptor::ArgTValue>());
+    ASSERT_EQ(1U, args[1].as<ArgDescValue>().elements.size());
+    EXPECT_EQ(8U, args[1].as<ArgDescValue>().elements[0].offset);
+    EXPECT_EQ(4U, args[1].as<ArgDescValue>().elements[0].size);
+}
+
+TEST(ProgramInfoCacheTests, givenImageOfDifferentDeviceBinaryWhenDeserializingThenFailsAndProgramInfoIsNotModified) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    auto image = ProgramInfoCache::serialize(decoded, zebin.storage);
+    ASSERT_FALSE(image.empty());
+
+    auto otherBinary = zebin.storage;
+    otherBinary[otherBinary.size() - 1] ^= 0xFF;
+    ProgramInfo restored;
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, image, otherBinary));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+    EXPECT_EQ(nullptr, restored.globalVariables.initData);
+
+    otherBinary = zebin.storage;
+    otherBinary.push_back(0);
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, image, otherBinary));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST(ProgramInfoCacheTests, givenCorruptedImageWhenDeserializingThenFails) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    auto image = ProgramInfoCache::serialize(decoded, zebin.storage);
+    ASSERT_FALSE(image.empty());
+
+    ProgramInfo restored;
+    auto truncatedImage = image;
+    truncatedImage.resize(image.size() - 1);
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, truncatedImage, zebin.storage));
+
+    auto oversizedImage = image;
+    oversizedImage.push_back(0);
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, oversizedImage, zebin.storage));
+
+    auto otherVersionImage = image;
+    uint32_t otherVersion = ProgramInfoCache::version + 1;
+    memcpy(otherVersionImage.data() + sizeof(uint32_t), &otherVersion, sizeof(otherVersion));
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, otherVersionImage, zebin.storage));
+
+    EXPECT_FALSE(ProgramInfoCache::deserialize(restored, {}, zebin.storage));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST(ProgramInfoCacheTests, givenDecoderAffectingDebugFlagChangedWhenDeserializingThenFails) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    auto image = ProgramInfoCache::serialize(decoded, zebin.storage);
+    ASSERT_FALSE(image.empty());
+
+    {
+        DebugManagerStateRestore restorer;
+        DebugManager.flags.ZebinAppendElws.set(true);
+        ProgramInfo restored;
+        EXPECT_FALSE(ProgramInfoCache::deserialize(restored, image, zebin.storage));
+    }
+    {
+        DebugManagerStateRestore restorer;
+        DebugManager.flags.ZebinIgnoreIcbeVersion.set(true);
+        ProgramInfo restored;
+        EXPECT_FALSE(ProgramInfoCache::deserialize(restored, image, zebin.storage));
+    }
+    ProgramInfo restored;
+    EXPECT_TRUE(ProgramInfoCache::deserialize(restored, image, zebin.storage));
+}
+
+TEST(ProgramInfoCacheTests, givenProgramInfoWithLinkerInputWhenSerializingThenImageIsEmpty) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    decoded.prepareLinkerInputStorage();
+    EXPECT_TRUE(ProgramInfoCache::serialize(decoded, zebin.storage).empty());
+}
+
+TEST(ProgramInfoCacheTests, givenKernelHeapOutsideOfDeviceBinaryWhenSerializingThenImageIsEmpty) {
+    ZebinWithKernels zebin;
+    ProgramInfo decoded;
+    zebin.decode(decoded);
+    uint8_t otherHeap[8] = {};
+    decoded.kernelInfos[0]->heapInfo.pKernelHeap = otherHeap;
+    EXPECT_TRUE(ProgramInfoCache::serialize(decoded, zebin.storage).empty());
+}
+
+TEST(DecodeSingleDeviceBinaryWithCache, givenProgramInfoCacheEnabledWhenDecodingZebinTwiceThenSecondDecodeIsRestoredFromCache) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableProgramInfoCache.set(1);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto compilerInterface = new MockCompilerInterface();
+    device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(compilerInterface);
+    auto cache = new ProgramInfoCacheMock();
+    compilerInterface->cache.reset(cache);
+
+    ZebinWithKernels zebin;
+    SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+
+    ProgramInfo decoded;
+    auto ret = decodeSingleDeviceBinaryWithCache(decoded, singleBinary, *device, decodeErrors, decodeWarnings);
+    EXPECT_EQ(DecodeError::Success, ret.first);
+    EXPECT_EQ(DeviceBinaryFormat::Zebin, ret.second);
+    EXPECT_EQ(1U, cache->loadInvoked);
+    EXPECT_EQ(1U, cache->cacheInvoked);
+    ASSERT_EQ(1U, cache->entries.size());
+    EXPECT_EQ(ProgramInfoCache::getCachedFileName(device->getHardwareInfo(), zebin.storage), cache->entries.begin()->first);
+
+    ProgramInfo restored;
+    ret = decodeSingleDeviceBinaryWithCache(restored, singleBinary, *device, decodeErrors, decodeWarnings);
+    EXPECT_EQ(DecodeError::Success, ret.first);
+    EXPECT_EQ(DeviceBinaryFormat::Zebin, ret.second);
+    EXPECT_EQ(2U, cache->loadInvoked);
+    EXPECT_EQ(1U, cache->cacheInvoked);
+    ASSERT_EQ(decoded.kernelInfos.size(), restored.kernelInfos.size());
+    for (size_t i = 0; i < decoded.kernelInfos.size(); ++i) {
+        EXPECT_EQ(decoded.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName, restored.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(decoded.kernelInfos[i]->heapInfo.pKernelHeap, restored.kernelInfos[i]->heapInfo.pKernelHeap);
+    }
+}
+
+TEST(DecodeSingleDeviceBinaryWithCache, givenStaleCacheEntryWhenDecodingZebinThenFullDecodeIsUsedAndEntryIsReplaced) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableProgramInfoCache.set(1);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto compilerInterface = new MockCompilerInterface();
+    device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(compilerInterface);
+    auto cache = new ProgramInfoCacheMock();
+    compilerInterface->cache.reset(cache);
+
+    ZebinWithKernels zebin;
+    auto cacheFileName = ProgramInfoCache::getCachedFileName(device->getHardwareInfo(), zebin.storage);
+    cache->entries[cacheFileName] = std::vector<char>(64, 0);
+
+    SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    ProgramInfo programInfo;
+    auto ret = decodeSingleDeviceBinaryWithCache(programInfo, singleBinary, *device, decodeErrors, decodeWarnings);
+    EXPECT_EQ(DecodeError::Success, ret.first);
+    EXPECT_EQ(2U, programInfo.kernelInfos.size());
+    EXPECT_EQ(1U, cache->cacheInvoked);
+    EXPECT_NE(std::vector<char>(64, 0), cache->entries[cacheFileName]);
+}
+
+TEST(DecodeSingleDeviceBinaryWithCache, givenProgramInfoCacheDisabledWhenDecodingZebinThenCacheIsNotUsed) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto compilerInterface = new MockCompilerInterface();
+    device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(compilerInterface);
+    auto cache = new ProgramInfoCacheMock();
+    compilerInterface->cache.reset(cache);
+
+    ZebinWithKernels zebin;
+    SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = zebin.storage;
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    ProgramInfo programInfo;
+    auto ret = decodeSingleDeviceBinaryWithCache(programInfo, singleBinary, *device, decodeErrors, decodeWarnings);
+    EXPECT_EQ(DecodeError::Success, ret.first);
+    EXPECT_EQ(2U, programInfo.kernelInfos.size());
+    EXPECT_EQ(0U, cache->loadInvoked);
+    EXPECT_EQ(0U, cache->cacheInvoked);
+}
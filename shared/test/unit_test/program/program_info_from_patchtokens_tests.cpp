@@ -11,6 +11,7 @@
 #include "shared/source/program/program_info_from_patchtokens.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -194,6 +195,47 @@ TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsThenKernelI
     EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[2]->gpuPointerSize);
 }
 
+TEST(PopulateProgramInfoFromPatchtokensTests, GivenMultiplePopulateThreadsThenKernelInfosAndLinkerInputArePopulatedInKernelsOrder) {
+    DebugManagerStateRestore dbgRestore;
+    NEO::DebugManager.flags.PatchTokensDecodeThreads.set(4);
+
+    NEO::ProgramInfo programInfo = {};
+    Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
+    programInfo.linkerInput.reset(mockLinkerInput);
+
+    constexpr size_t numKernels = 100U;
+    PatchTokensTestData::ValidProgramWithKernel programFromTokens;
+    programFromTokens.kernels.resize(numKernels, programFromTokens.kernels[0]);
+    std::vector<std::string> kernelNames;
+    for (size_t i = 0; i < numKernels; ++i) {
+        kernelNames.push_back("kernel_" + std::to_string(i));
+    }
+    for (size_t i = 0; i < numKernels; ++i) {
+        programFromTokens.kernels[i].name = ArrayRef<const char>(kernelNames[i].c_str(), kernelNames[i].size() + 1);
+    }
+
+    iOpenCL::SPatchFunctionTableInfo symbolTable = {};
+    symbolTable.NumEntries = 0;
+    programFromTokens.kernels[30].tokens.programSymbolTable = &symbolTable;
+    programFromTokens.kernels[70].tokens.programSymbolTable = &symbolTable;
+
+    std::vector<uint32_t> receivedSegmentIds;
+    mockLinkerInput->decodeExportedFunctionsSymbolTableMockConfig.overrideFunc = [&](Mock<NEO::LinkerInput> *, const void *, uint32_t, uint32_t instructionsSegmentId) -> bool {
+        receivedSegmentIds.push_back(instructionsSegmentId);
+        return true;
+    };
+    NEO::populateProgramInfo(programInfo, programFromTokens);
+
+    ASSERT_EQ(numKernels, programInfo.kernelInfos.size());
+    for (size_t i = 0; i < numKernels; ++i) {
+        EXPECT_EQ(kernelNames[i], programInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(programFromTokens.header->GPUPointerSizeInBytes, programInfo.kernelInfos[i]->gpuPointerSize);
+    }
+    ASSERT_EQ(2U, receivedSegmentIds.size());
+    EXPECT_EQ(30U, receivedSegmentIds[0]);
+    EXPECT_EQ(70U, receivedSegmentIds[1]);
+}
+
 TEST(PopulateProgramInfoFromPatchtokensTests, GivenProgramWithKernelsWhenKernelHasSymbolTableThenLinkerIsUpdatedWithAdditionalSymbolInfo) {
     NEO::ProgramInfo programInfo = {};
     Mock<NEO::LinkerInput> *mockLinkerInput = new Mock<NEO::LinkerInput>;
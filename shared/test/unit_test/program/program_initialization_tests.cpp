@@ -11,6 +11,7 @@
 #include "shared/test/unit_test/mocks/mock_device.h"
 #include "shared/test/unit_test/test_macros/test_checks_shared.h"
 
+#include "opencl/test/unit_test/mocks/mock_allocation_properties.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "opencl/test/unit_test/mocks/mock_svm_manager.h"
@@ -252,3 +253,70 @@ TEST(AllocateGlobalSurfaceTest, GivenAllocationInLocalMemoryWhichRequiresBlitter
         }
     }
 }
+
+TEST(AllocateGlobalSurfaceTest, GivenPendingTransfersWhenAllocatingGlobalsSurfaceThenUploadIsDeferredUntilTransfersAreSubmitted) {
+    MockDevice device;
+    std::vector<uint8_t> initData;
+    initData.resize(64, 7U);
+    MemoryTransfers pendingTransfers;
+
+    auto alloc = allocateGlobalsSurface(nullptr /* svmAllocsManager */, device, initData.size(), true /* constant */, nullptr /* linker input */, initData.data(), pendingTransfers);
+    ASSERT_NE(nullptr, alloc);
+    ASSERT_EQ(1u, pendingTransfers.size());
+    EXPECT_EQ(alloc, pendingTransfers[0].dstAllocation);
+    EXPECT_EQ(0u, pendingTransfers[0].dstOffset);
+    EXPECT_EQ(initData.data(), pendingTransfers[0].srcMemory);
+    EXPECT_EQ(initData.size(), pendingTransfers[0].srcSize);
+
+    memset(alloc->getUnderlyingBuffer(), 0, initData.size());
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, pendingTransfers));
+    EXPECT_EQ(0, memcmp(alloc->getUnderlyingBuffer(), initData.data(), initData.size()));
+    device.getMemoryManager()->freeGraphicsMemory(alloc);
+}
+
+TEST(MemoryTransferHelperTest, GivenTransfersRequiringBlitterWhenTransferringMemoryToAllocationsThenAllBlitsAreSubmittedInOneBatch) {
+    uint32_t batchesCounter = 0;
+    size_t blitsCounter = 0;
+    auto mockBlitMemoryToAllocations = [&batchesCounter, &blitsCounter](const Device &device, const MemoryTransfers &transfers) -> BlitOperationResult {
+        batchesCounter++;
+        blitsCounter += transfers.size();
+        return BlitOperationResult::Success;
+    };
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitMemoryToAllocationsFuncBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, mockBlitMemoryToAllocations};
+
+    MockDevice device;
+    uint8_t srcData[16];
+    memset(srcData, 5, sizeof(srcData));
+    GraphicsAllocation *allocations[3] = {};
+    MemoryTransfers transfers;
+    for (auto &allocation : allocations) {
+        allocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device.getRootDeviceIndex(), sizeof(srcData)});
+        ASSERT_NE(nullptr, allocation);
+        memset(allocation->getUnderlyingBuffer(), 0, sizeof(srcData));
+
+        MemoryTransfer transfer;
+        transfer.dstAllocation = allocation;
+        transfer.srcMemory = srcData;
+        transfer.srcSize = sizeof(srcData);
+        transfer.useBlitter = (allocation != allocations[1]);
+        transfers.push_back(transfer);
+    }
+
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, transfers));
+    EXPECT_EQ(1u, batchesCounter);
+    EXPECT_EQ(2u, blitsCounter);
+    EXPECT_NE(0, memcmp(allocations[0]->getUnderlyingBuffer(), srcData, sizeof(srcData)));
+    EXPECT_EQ(0, memcmp(allocations[1]->getUnderlyingBuffer(), srcData, sizeof(srcData)));
+    EXPECT_NE(0, memcmp(allocations[2]->getUnderlyingBuffer(), srcData, sizeof(srcData)));
+
+    batchesCounter = 0;
+    transfers.erase(transfers.begin());
+    transfers.pop_back();
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, transfers));
+    EXPECT_EQ(0u, batchesCounter);
+
+    for (auto &allocation : allocations) {
+        device.getMemoryManager()->freeGraphicsMemory(allocation);
+    }
+}
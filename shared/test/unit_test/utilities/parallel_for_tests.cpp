@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+struct FailingThread : std::thread {
+    static std::atomic<uint32_t> threadsToCreate;
+
+    template <typename FunctionT>
+    FailingThread(FunctionT &&function) : std::thread(create(std::forward<FunctionT>(function))) {}
+
+    template <typename FunctionT>
+    static std::thread create(FunctionT &&function) {
+        if (threadsToCreate == 0U) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        threadsToCreate--;
+        return std::thread(std::forward<FunctionT>(function));
+    }
+};
+std::atomic<uint32_t> FailingThread::threadsToCreate{0U};
+} // namespace
+
+TEST(ParallelForTest, givenMultipleThreadsWhenRunningParallelForThenEachItemIsProcessedOnce) {
+    std::vector<std::atomic<uint32_t>> processedCount(100);
+    parallelFor(processedCount.size(), 4U, [&](size_t itemId) { processedCount[itemId]++; });
+    for (auto &count : processedCount) {
+        EXPECT_EQ(1U, count);
+    }
+}
+
+TEST(ParallelForTest, givenSingleThreadWhenRunningParallelForThenItemsAreProcessedInOrderOnCallingThread) {
+    std::vector<size_t> processedItems;
+    std::vector<std::thread::id> processingThreads;
+    parallelFor(3U, 1U, [&](size_t itemId) {
+        processedItems.push_back(itemId);
+        processingThreads.push_back(std::this_thread::get_id());
+    });
+    EXPECT_EQ((std::vector<size_t>{0U, 1U, 2U}), processedItems);
+    for (auto &threadId : processingThreads) {
+        EXPECT_EQ(std::this_thread::get_id(), threadId);
+    }
+}
+
+TEST(ParallelForTest, givenThreadCreationFailureWhenRunningParallelForThenAllItemsAreStillProcessed) {
+    for (uint32_t threadsCreated : {0U, 1U}) {
+        FailingThread::threadsToCreate = threadsCreated;
+        std::vector<std::atomic<uint32_t>> processedCount(100);
+        parallelFor<FailingThread>(processedCount.size(), 4U, [&](size_t itemId) { processedCount[itemId]++; });
+        for (auto &count : processedCount) {
+            EXPECT_EQ(1U, count);
+        }
+        EXPECT_EQ(0U, FailingThread::threadsToCreate);
+    }
+}